@@ -47,6 +47,7 @@ static const char *e1000_reg_to_string(enum e1000_reg_t r)
 	_(ICR);
 	_(ICS);
 	_(IMS);
+	_(IMC);
 	_(RCTL);
 	_(TCTL);
 	_(RDBAL);
@@ -190,11 +191,17 @@ static void e1000_isr(const struct device *ddev)
 	icr &= ~(ICR_TXDW | ICR_TXQE);
 
 	if (icr & (ICR_RXO | ICR_RXDMT0 | ICR_RXT0)) {
+#if defined(CONFIG_NET_NAPI)
+		/* Masked until the poll function has caught up */
+		iow32(dev, IMC, IMS_RXDMT0 | IMS_RXO | IMS_RXT0);
+		net_napi_schedule(&dev->napi);
+#else
 		struct net_pkt *pkt = NULL;
 
 		while ((pkt = e1000_rx(dev))) {
 			net_recv_data(get_iface(dev), pkt);
 		}
+#endif
 
 		icr &= ~(ICR_RXO | ICR_RXDMT0 | ICR_RXT0);
 	}
@@ -204,6 +211,33 @@ static void e1000_isr(const struct device *ddev)
 	}
 }
 
+#if defined(CONFIG_NET_NAPI)
+static int e1000_poll(struct net_napi *napi, int budget)
+{
+	struct e1000_dev *dev = CONTAINER_OF(napi, struct e1000_dev, napi);
+	struct net_pkt *pkt;
+	int done = 0;
+
+	while (done < budget && (pkt = e1000_rx(dev))) {
+		if (net_napi_receive(napi, pkt) < 0) {
+			net_pkt_unref(pkt);
+		}
+
+		done++;
+	}
+
+	if (done < budget) {
+		net_napi_complete(napi);
+
+		/* The causes latched while masked raise the interrupt again
+		 * as soon as they are unmasked.
+		 */
+		iow32(dev, IMS, IMS_RXDMT0 | IMS_RXO | IMS_RXT0);
+	}
+
+	return done;
+}
+#endif /* CONFIG_NET_NAPI */
 
 int e1000_probe(const struct device *ddev)
 {
@@ -272,6 +306,10 @@ static void e1000_iface_init(struct net_if *iface)
 	if (dev->iface == NULL) {
 		dev->iface = iface;
 
+#if defined(CONFIG_NET_NAPI)
+		net_napi_init(&dev->napi, iface, e1000_poll);
+#endif
+
 		/* Do the phy link up only once */
 		config->config_func(dev);
 	}
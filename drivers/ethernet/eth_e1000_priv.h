@@ -44,6 +44,7 @@ enum e1000_reg_t {
 	ITR	= 0x00C4,	/* Interrupt Throttling Rate */
 	ICS	= 0x00C8,	/* Interrupt Cause Set */
 	IMS	= 0x00D0,	/* Interrupt Mask Set */
+	IMC	= 0x00D8,	/* Interrupt Mask Clear */
 	RCTL	= 0x0100,	/* Receive Control */
 	TCTL	= 0x0400,	/* Transmit Control */
 	RDBAL	= 0x2800,	/* Rx Descriptor Base Address Low */
@@ -100,6 +101,9 @@ struct e1000_dev {
 	uint8_t mac[ETH_ALEN];
 	uint8_t txb[CONFIG_ETH_E1000_TX_QUEUE_SIZE][NET_ETH_MTU];
 	uint8_t rxb[CONFIG_ETH_E1000_RX_QUEUE_SIZE][NET_ETH_MTU];
+#if defined(CONFIG_NET_NAPI)
+	struct net_napi napi;
+#endif
 #if defined(CONFIG_ETH_E1000_PTP_CLOCK)
 	const struct device *ptp_clock;
 #endif
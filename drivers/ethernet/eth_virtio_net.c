@@ -11,6 +11,7 @@
 #include <zephyr/drivers/virtio/virtqueue.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
 #include "eth.h"
 
 #define DT_DRV_COMPAT virtio_net
@@ -87,6 +88,18 @@ enum _virtio_net_hdr_gso_types {
 
 #define VIRTIO_NET_BUFLEN                                                                          \
 	(NET_ETH_MTU + sizeof(struct net_eth_hdr) + sizeof(struct _virtio_net_hdr))
+
+#if defined(CONFIG_NET_GSO)
+/* Room for the GSO packets given as is to the device */
+#define VIRTIO_NET_TX_BUFLEN                                                                       \
+	(MAX(NET_ETH_MTU, CONFIG_NET_GSO_MAX_SIZE) + sizeof(struct net_eth_vlan_hdr) +             \
+	 sizeof(struct _virtio_net_hdr))
+#else
+#define VIRTIO_NET_TX_BUFLEN VIRTIO_NET_BUFLEN
+#endif
+
+/* Offset of the checksum in the TCP header */
+#define VIRTIO_NET_TCP_CSUM_OFFSET 16
 /* virtqueue pairs are numbered from 1 upwards */
 /* convert pair number to virtqueue index */
 #define VIRTQ_RX(n) ((n - 1) * 2)
@@ -110,7 +123,12 @@ struct virtnet_data {
 	const struct _virtio_net_config *virtio_devcfg;
 	uint8_t mac[6];
 	struct _rx_cb_data rx_cb_data[CONFIG_ETH_VIRTIO_NET_RX_BUFFERS];
-	uint8_t txb[VIRTIO_NET_BUFLEN];
+	/* TCP checksum and segmentation offloads negotiated */
+	bool tso;
+#if defined(CONFIG_NET_NAPI)
+	struct net_napi napi;
+#endif
+	uint8_t txb[VIRTIO_NET_TX_BUFLEN];
 	uint8_t rxb[CONFIG_ETH_VIRTIO_NET_RX_BUFFERS][VIRTIO_NET_BUFLEN];
 };
 
@@ -125,21 +143,138 @@ static uint16_t virtnet_enum_queues_cb(uint16_t q_index, uint16_t q_size_max, vo
 
 static enum ethernet_hw_caps virtnet_get_capabilities(const struct device *dev)
 {
-	return ETHERNET_LINK_10BASE | ETHERNET_LINK_100BASE | ETHERNET_LINK_1000BASE |
-	       ETHERNET_LINK_2500BASE | ETHERNET_LINK_5000BASE;
+	struct virtnet_data *data = dev->data;
+	enum ethernet_hw_caps caps = ETHERNET_LINK_10BASE | ETHERNET_LINK_100BASE |
+				     ETHERNET_LINK_1000BASE | ETHERNET_LINK_2500BASE |
+				     ETHERNET_LINK_5000BASE;
+
+	if (data->tso) {
+		caps |= ETHERNET_HW_TX_CHKSUM_OFFLOAD | ETHERNET_HW_TSO;
+	}
+
+	return caps;
+}
+
+static int virtnet_get_config(const struct device *dev, enum ethernet_config_type type,
+			      struct ethernet_config *cfg)
+{
+	switch (type) {
+	case ETHERNET_CONFIG_TYPE_TX_CHECKSUM_SUPPORT:
+		/* The IPv4 header checksum is computed by the driver */
+		cfg->chksum_support = ETHERNET_CHECKSUM_SUPPORT_IPV4_HEADER |
+				      ETHERNET_CHECKSUM_SUPPORT_IPV6_HEADER |
+				      ETHERNET_CHECKSUM_SUPPORT_TCP;
+		return 0;
+	default:
+		break;
+	}
+
+	return -ENOTSUP;
+}
+
+static uint32_t virtnet_csum_add(uint32_t sum, const uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		sum += sys_get_be16(&buf[i]);
+	}
+
+	if (len & 1) {
+		sum += (uint32_t)buf[len - 1] << 8;
+	}
+
+	return sum;
+}
+
+static uint16_t virtnet_csum_fold(uint32_t sum)
+{
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return sum;
+}
+
+/* Fill in the virtio header of a frame for the device to compute the TCP
+ * checksum and, for a GSO packet, to cut it into segments. The TCP checksum
+ * field is set to the pseudo header checksum, as expected by the device.
+ * TCP segments are sent without IPv6 extension headers.
+ */
+static void virtnet_tx_offload(struct _virtio_net_hdr *hdr, uint8_t *frame, uint16_t gso_size)
+{
+	size_t l3 = sizeof(struct net_eth_hdr);
+	uint16_t type = sys_get_be16(&frame[l3 - 2]);
+	size_t l4;
+	uint16_t l4_len;
+	uint32_t sum;
+
+	if (type == NET_ETH_PTYPE_VLAN) {
+		l3 += NET_ETH_VLAN_HDR_SIZE;
+		type = sys_get_be16(&frame[l3 - 2]);
+	}
+
+	if (type == NET_ETH_PTYPE_IP) {
+		size_t ihl = (frame[l3] & 0x0f) * 4U;
+
+		sys_put_be16(0, &frame[l3 + 10]);
+		sys_put_be16(~virtnet_csum_fold(virtnet_csum_add(0, &frame[l3], ihl)),
+			     &frame[l3 + 10]);
+
+		if (frame[l3 + 9] != NET_IPPROTO_TCP) {
+			return;
+		}
+
+		l4 = l3 + ihl;
+		l4_len = sys_get_be16(&frame[l3 + 2]) - ihl;
+		sum = virtnet_csum_add(0, &frame[l3 + 12], 8);
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV4;
+	} else if (type == NET_ETH_PTYPE_IPV6 && frame[l3 + 6] == NET_IPPROTO_TCP) {
+		l4 = l3 + NET_IPV6H_LEN;
+		l4_len = sys_get_be16(&frame[l3 + 4]);
+		sum = virtnet_csum_add(0, &frame[l3 + 8], 32);
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_TCPV6;
+	} else {
+		return;
+	}
+
+	sum += NET_IPPROTO_TCP + l4_len;
+	sys_put_be16(virtnet_csum_fold(sum), &frame[l4 + VIRTIO_NET_TCP_CSUM_OFFSET]);
+
+	hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+	hdr->csum_start = sys_cpu_to_le16(l4);
+	hdr->csum_offset = sys_cpu_to_le16(VIRTIO_NET_TCP_CSUM_OFFSET);
+
+	if (gso_size > 0) {
+		hdr->hdr_len = sys_cpu_to_le16(l4 + (frame[l4 + 12] >> 4) * 4U);
+		hdr->gso_size = sys_cpu_to_le16(gso_size);
+	} else {
+		hdr->gso_type = VIRTIO_NET_HDR_GSO_NONE;
+	}
 }
 
 static int virtnet_send(const struct device *dev, struct net_pkt *pkt)
 {
 	const struct virtnet_config *config = dev->config;
 	struct virtnet_data *data = dev->data;
+	struct _virtio_net_hdr *hdr = (struct _virtio_net_hdr *)data->txb;
+	uint8_t *frame = data->txb + sizeof(struct _virtio_net_hdr);
 	size_t len = net_pkt_get_len(pkt);
 
-	if (net_pkt_read(pkt, data->txb + sizeof(struct _virtio_net_hdr), len)) {
+	if (len > sizeof(data->txb) - sizeof(struct _virtio_net_hdr)) {
+		LOG_ERR("packet of %zu bytes too large", len);
+		return -EMSGSIZE;
+	}
+
+	if (net_pkt_read(pkt, frame, len)) {
 		LOG_ERR("could not read contents of packet to be sent");
 		return -EIO;
 	}
 
+	memset(hdr, 0, sizeof(*hdr));
+
+	if (data->tso) {
+		virtnet_tx_offload(hdr, frame, net_pkt_gso_size(pkt));
+	}
+
 	struct virtq *vq = virtio_get_virtqueue(config->vdev, VIRTQ_TX(1));
 	struct virtq_buf vqbuf[] = {
 		{.addr = data->txb, .len = sizeof(struct _virtio_net_hdr) + len}};
@@ -169,7 +304,11 @@ void virtnet_rx_cb(void *priv, uint32_t len)
 	} else if (net_pkt_write(pkt, &(data->rxb[buf_no][sizeof(struct _virtio_net_hdr)]), len)) {
 		LOG_ERR("could not copy entire received packet");
 		net_pkt_unref(pkt);
+#if defined(CONFIG_NET_NAPI)
+	} else if (net_napi_receive(&data->napi, pkt)) {
+#else
 	} else if (net_recv_data(data->iface, pkt)) {
+#endif
 		LOG_ERR("operating system failed to receive packet");
 		net_pkt_unref(pkt);
 	} else {
@@ -181,6 +320,41 @@ void virtnet_rx_cb(void *priv, uint32_t len)
 	virtio_notify_virtqueue(config->vdev, VIRTQ_RX(1));
 }
 
+#if defined(CONFIG_NET_NAPI)
+/* Called from the interrupt handler when the device returned RX buffers */
+static void virtnet_rx_notify(void *opaque)
+{
+	struct virtnet_data *data = opaque;
+	const struct virtnet_config *config = data->dev->config;
+
+	virtq_enable_interrupt(virtio_get_virtqueue(config->vdev, VIRTQ_RX(1)), false);
+	net_napi_schedule(&data->napi);
+}
+
+static int virtnet_poll(struct net_napi *napi, int budget)
+{
+	struct virtnet_data *data = CONTAINER_OF(napi, struct virtnet_data, napi);
+	const struct virtnet_config *config = data->dev->config;
+	struct virtq *vq = virtio_get_virtqueue(config->vdev, VIRTQ_RX(1));
+	int done;
+
+	done = virtq_poll(vq, budget);
+	if (done < budget) {
+		net_napi_complete(napi);
+		virtq_enable_interrupt(vq, true);
+
+		/* The device did not interrupt for the buffers returned
+		 * before the interrupt was enabled.
+		 */
+		if (virtq_has_used(vq)) {
+			virtnet_rx_notify(data);
+		}
+	}
+
+	return done;
+}
+#endif /* CONFIG_NET_NAPI */
+
 static void virtnet_if_init(struct net_if *iface)
 {
 	ethernet_init(iface);
@@ -192,6 +366,11 @@ static void virtnet_if_init(struct net_if *iface)
 	net_if_set_link_addr(iface, data->mac, sizeof(data->virtio_devcfg->mac), NET_LINK_ETHERNET);
 	struct virtq *vq = virtio_get_virtqueue(config->vdev, VIRTQ_RX(1));
 
+#if defined(CONFIG_NET_NAPI)
+	net_napi_init(&data->napi, iface, virtnet_poll);
+	virtq_set_polled(vq, virtnet_rx_notify, data);
+#endif
+
 	for (int i = 0; i < CONFIG_ETH_VIRTIO_NET_RX_BUFFERS; i++) {
 		data->rx_cb_data[i].data = data;
 		data->rx_cb_data[i].buf_no = i;
@@ -216,6 +395,19 @@ static int virtnet_dev_init(const struct device *dev)
 	if (data->virtio_devcfg == NULL) {
 		LOG_ERR("could not get config struct");
 	}
+
+	if (IS_ENABLED(CONFIG_NET_GSO) &&
+	    virtio_read_device_feature_bit(config->vdev, VIRTIO_NET_F_CSUM) &&
+	    virtio_read_device_feature_bit(config->vdev, VIRTIO_NET_F_HOST_TSO4) &&
+	    virtio_read_device_feature_bit(config->vdev, VIRTIO_NET_F_HOST_TSO6)) {
+		data->tso = !virtio_write_driver_feature_bit(config->vdev, VIRTIO_NET_F_CSUM,
+							     true) &&
+			    !virtio_write_driver_feature_bit(config->vdev, VIRTIO_NET_F_HOST_TSO4,
+							     true) &&
+			    !virtio_write_driver_feature_bit(config->vdev, VIRTIO_NET_F_HOST_TSO6,
+							     true);
+	}
+
 	if (virtio_commit_feature_bits(config->vdev)) {
 		LOG_ERR("could not commit feature bits");
 	}
@@ -231,6 +423,7 @@ static int virtnet_dev_init(const struct device *dev)
 static struct ethernet_api virtnet_api = {
 	.iface_api.init = virtnet_if_init,
 	.get_capabilities = virtnet_get_capabilities,
+	.get_config = virtnet_get_config,
 	.send = virtnet_send,
 };
 
@@ -361,7 +361,9 @@ static struct net_pkt *eth_xmc4xxx_rx_pkt(const struct device *dev)
 	struct eth_xmc4xxx_data *dev_data = dev->data;
 	const struct eth_xmc4xxx_config *dev_cfg = dev->config;
 	struct net_pkt *pkt = NULL;
-	struct net_buf *new_frag;
+	struct net_buf *new_frags[NUM_RX_DMA_DESCRIPTORS];
+	size_t new_frag_count = 0;
+	size_t new_frag_index = 0;
 
 	bool eof_found = false;
 	uint16_t tail;
@@ -432,13 +434,33 @@ static struct net_pkt *eth_xmc4xxx_rx_pkt(const struct device *dev)
 #endif
 		LOG_DBG("Net packet allocation error");
 		/* continue because we still need to read out the packet. */
+	} else {
+		struct net_buf_pool *rx_pool;
+		size_t needed = DIV_ROUND_UP(remaining_length, CONFIG_NET_BUF_DATA_SIZE);
+
+		/* Allocate the substitutes of all the fragments of the frame
+		 * at once, instead of one by one in the loop below.
+		 */
+		net_pkt_get_info(NULL, NULL, &rx_pool, NULL);
+		new_frag_count = net_buf_alloc_bulk(rx_pool, CONFIG_NET_BUF_DATA_SIZE, new_frags,
+						    needed, K_NO_WAIT);
+		if (new_frag_count < needed) {
+#ifdef CONFIG_NET_STATISTICS_ETHERNET
+			dev_data->stats.errors.rx++;
+			dev_data->stats.error_details.rx_buf_alloc_failed++;
+#endif
+			net_buf_unref_chain_bulk(new_frags, new_frag_count);
+			net_pkt_unref(pkt);
+			pkt = NULL;
+			LOG_DBG("Frag allocation error. Increase CONFIG_NET_BUF_RX_COUNT.");
+		}
 	}
 
 	/* In this loop, the following actions are taken:
 	 *
 	 * 1 - If a packet has been successfully allocated, retrieve the fresh
-	 *     fragment from the DMA descriptor and substitute it with a new one
-	 *     allocated from the pool.
+	 *     fragment from the DMA descriptor and substitute it with one of the
+	 *     new fragments allocated above.
 	 *
 	 * 2 - Link each retrieved fragment in a list in the newly allocated
 	 *     packet.
@@ -488,35 +510,23 @@ static struct net_pkt *eth_xmc4xxx_rx_pkt(const struct device *dev)
 				net_buf_reset(frag);
 				goto prepare_dma_descriptor;
 			}
-			/* Allocate a new net fragment to substitute the current
-			 * one on the current DMA descriptor.
-			 */
-			new_frag = net_pkt_get_frag(pkt, CONFIG_NET_BUF_DATA_SIZE, K_NO_WAIT);
-			if (!new_frag) {
-#ifdef CONFIG_NET_STATISTICS_ETHERNET
-				dev_data->stats.errors.rx++;
-				dev_data->stats.error_details.rx_buf_alloc_failed++;
-#endif
-				net_pkt_unref(pkt);
-				pkt = NULL;
-				LOG_DBG("Frag allocation error. Increase CONFIG_NET_BUF_RX_COUNT.");
+			/* Sets the received fragment length */
+			net_buf_add(frag, fragment_length);
+			if (!prev_frag) {
+				/* The first fragment goes to the packet. */
+				net_pkt_frag_insert(pkt, frag);
 			} else {
-				/* Sets the received fragment length */
-				net_buf_add(frag, fragment_length);
-				if (!prev_frag) {
-					/* The first fragment goes to the
-					 * packet.
-					 */
-					net_pkt_frag_insert(pkt, frag);
-				} else {
-					/* Other fragments get added to the
-					 * previous fragment.
-					 */
-					net_buf_frag_insert(prev_frag, frag);
-				}
-				prev_frag = frag;
-				dev_data->rx_frag_list[tail] = new_frag;
+				/* Other fragments get added to the previous
+				 * fragment.
+				 */
+				net_buf_frag_insert(prev_frag, frag);
 			}
+			prev_frag = frag;
+			/* Substitute the current fragment on the current DMA
+			 * descriptor with one allocated above.
+			 */
+			__ASSERT_NO_MSG(new_frag_index < new_frag_count);
+			dev_data->rx_frag_list[tail] = new_frags[new_frag_index++];
 		}
 
 prepare_dma_descriptor:
@@ -750,18 +760,16 @@ static inline void eth_xmc4xxx_free_rx_bufs(const struct device *dev)
 {
 	struct eth_xmc4xxx_data *dev_data = dev->data;
 
-	for (int i = 0; i < NUM_RX_DMA_DESCRIPTORS; i++) {
-		if (dev_data->rx_frag_list[i]) {
-			net_buf_unref(dev_data->rx_frag_list[i]);
-			dev_data->rx_frag_list[i] = NULL;
-		}
-	}
+	net_buf_unref_chain_bulk(dev_data->rx_frag_list, NUM_RX_DMA_DESCRIPTORS);
+	memset(dev_data->rx_frag_list, 0, sizeof(dev_data->rx_frag_list));
 }
 
 static int eth_xmc4xxx_rx_dma_descriptors_init(const struct device *dev)
 {
 	struct eth_xmc4xxx_data *dev_data = dev->data;
 	const struct eth_xmc4xxx_config *dev_cfg = dev->config;
+	struct net_buf_pool *rx_pool;
+	size_t count;
 
 	dev_cfg->regs->RECEIVE_DESCRIPTOR_LIST_ADDRESS = (uint32_t)&rx_dma_desc[0];
 
@@ -774,18 +782,20 @@ static int eth_xmc4xxx_rx_dma_descriptors_init(const struct device *dev)
 	rx_dma_desc[NUM_RX_DMA_DESCRIPTORS - 1].status |= ETH_MAC_DMA_TDES0_TER;
 	rx_dma_desc[NUM_RX_DMA_DESCRIPTORS - 1].buffer2 = (volatile uint32_t)&rx_dma_desc[0];
 
+	/* Reserve the buffers of all the descriptors at once */
+	net_pkt_get_info(NULL, NULL, &rx_pool, NULL);
+	count = net_buf_alloc_bulk(rx_pool, CONFIG_NET_BUF_DATA_SIZE, dev_data->rx_frag_list,
+				   NUM_RX_DMA_DESCRIPTORS, K_NO_WAIT);
+	if (count < NUM_RX_DMA_DESCRIPTORS) {
+		eth_xmc4xxx_free_rx_bufs(dev);
+		LOG_ERR("Failed to reserve data net buffers");
+		return -ENOBUFS;
+	}
+
 	for (int i = 0; i < NUM_RX_DMA_DESCRIPTORS; i++) {
 		XMC_ETH_MAC_DMA_DESC_t *dma_desc = &rx_dma_desc[i];
-		struct net_buf *rx_buf =
-			net_pkt_get_reserve_rx_data(CONFIG_NET_BUF_DATA_SIZE, K_NO_WAIT);
-
-		if (rx_buf == NULL) {
-			eth_xmc4xxx_free_rx_bufs(dev);
-			LOG_ERR("Failed to reserve data net buffers");
-			return -ENOBUFS;
-		}
+		struct net_buf *rx_buf = dev_data->rx_frag_list[i];
 
-		dev_data->rx_frag_list[i] = rx_buf;
 		dma_desc->buffer1 = (uint32_t)rx_buf->data;
 		dma_desc->length = rx_buf->size | ETH_RX_DMA_DESC_SECOND_ADDR_CHAINED_MASK;
 		dma_desc->status = ETH_MAC_DMA_RDES0_OWN;
@@ -66,6 +66,8 @@ int virtq_create(struct virtq *v, size_t size)
 	memset(v_area, 0, v_size);
 
 	v->last_used_idx = 0;
+	v->notify_cb = NULL;
+	v->notify_opaque = NULL;
 
 	k_stack_alloc_init(&v->free_desc_stack, size);
 	for (uint16_t i = 0; i < size; i++) {
@@ -186,3 +188,71 @@ void virtq_add_free_desc(struct virtq *v, uint16_t desc_idx)
 	k_stack_push(&v->free_desc_stack, desc_idx);
 	v->free_desc_n++;
 }
+
+int virtq_poll(struct virtq *v, int budget)
+{
+	uint16_t used_idx = sys_le16_to_cpu(v->used->idx);
+	int done = 0;
+
+	while (v->last_used_idx != used_idx && done < budget) {
+		uint16_t idx = v->last_used_idx % v->num;
+		uint16_t idx_le = sys_cpu_to_le16(idx);
+		uint16_t chain_head_le = v->used->ring[idx_le].id;
+		uint16_t chain_head = sys_le16_to_cpu(chain_head_le);
+		uint32_t used_len = sys_le32_to_cpu(v->used->ring[idx_le].len);
+
+		/*
+		 * We are making a copy here, because chain will be
+		 * returned before invoking the callback and may be
+		 * overwritten by the time callback is called. This
+		 * is to allow callback to immediately place the
+		 * descriptors back in the avail_ring
+		 */
+		struct virtq_receive_callback_entry cbe = v->recv_cbs[chain_head];
+
+		uint16_t next = chain_head;
+		bool last = false;
+
+		/*
+		 * We are done processing the descriptor chain, and
+		 * we can add used descriptors back to the free stack.
+		 * The only thing left to do is calling the callback
+		 * associated with the chain, but it was saved above on
+		 * the stack, so other code is free to use the descriptors
+		 */
+		while (!last) {
+			uint16_t curr = next;
+			uint16_t curr_le = sys_cpu_to_le16(curr);
+
+			next = v->desc[curr_le].next;
+			last = !(v->desc[curr_le].flags & VIRTQ_DESC_F_NEXT);
+			virtq_add_free_desc(v, curr);
+		}
+
+		v->last_used_idx++;
+		done++;
+
+		if (cbe.cb) {
+			cbe.cb(cbe.opaque, used_len);
+		}
+	}
+
+	return done;
+}
+
+bool virtq_has_used(struct virtq *v)
+{
+	return v->last_used_idx != sys_le16_to_cpu(v->used->idx);
+}
+
+void virtq_set_polled(struct virtq *v, virtq_notify_callback cb, void *cb_opaque)
+{
+	v->notify_opaque = cb_opaque;
+	v->notify_cb = cb;
+}
+
+void virtq_enable_interrupt(struct virtq *v, bool enable)
+{
+	v->avail->flags = enable ? 0 : sys_cpu_to_le16(VIRTQ_AVAIL_F_NO_INTERRUPT);
+	barrier_dmem_fence_full();
+}
@@ -34,6 +34,10 @@ extern "C" {
  * used in virtq_desc::flags, makes descriptor device writeable
  */
 #define VIRTQ_DESC_F_WRITE 2
+/**
+ * used in virtq_avail::flags, asks the device not to interrupt when it uses a buffer
+ */
+#define VIRTQ_AVAIL_F_NO_INTERRUPT 1
 
 /**
  * @brief virtqueue descriptor
@@ -66,7 +70,7 @@ struct virtq_desc {
  */
 struct virtq_avail {
 	/**
-	 * ring flags, e.g. VIRTQ_AVAIL_F_NO_INTERRUPT, currently unused
+	 * ring flags, e.g. VIRTQ_AVAIL_F_NO_INTERRUPT
 	 */
 	uint16_t flags;
 	/**
@@ -123,6 +127,13 @@ struct virtq_used {
  */
 typedef void (*virtq_receive_callback)(void *opaque, uint32_t used_len);
 
+/**
+ * @brief notify callback function type
+ *
+ * @param opaque argument passed to the callback
+ */
+typedef void (*virtq_notify_callback)(void *opaque);
+
 /**
  * @brief callback descriptor
  *
@@ -191,6 +202,16 @@ struct virtq {
 	 * array with callbacks invoked after receiving buffers back from the device
 	 */
 	struct virtq_receive_callback_entry *recv_cbs;
+
+	/**
+	 * callback invoked from the interrupt handler when the virtqueue is polled,
+	 * the used descriptor chains are then left to virtq_poll
+	 */
+	virtq_notify_callback notify_cb;
+	/**
+	 * argument passed to notify_cb
+	 */
+	void *notify_opaque;
 };
 
 
@@ -267,6 +288,49 @@ void virtq_add_free_desc(struct virtq *v, uint16_t desc_idx);
  */
 int virtq_get_free_desc(struct virtq *v, uint16_t *desc_idx, k_timeout_t timeout);
 
+/**
+ * @brief processes descriptor chains returned by the device
+ *
+ * Returns the descriptors of each chain to the free stack and invokes the callback
+ * associated with the chain
+ *
+ * @param v virtqueue it operates on
+ * @param budget maximum amount of descriptor chains to process
+ * @return amount of processed descriptor chains
+ */
+int virtq_poll(struct virtq *v, int budget);
+
+/**
+ * @brief checks if the device returned descriptor chains not processed yet
+ *
+ * @param v virtqueue it operates on
+ * @return true if there are descriptor chains to process
+ */
+bool virtq_has_used(struct virtq *v);
+
+/**
+ * @brief makes the virtqueue polled by the driver
+ *
+ * The interrupt handler no longer processes the descriptor chains returned by the
+ * device, it invokes cb instead and the driver processes them with virtq_poll
+ *
+ * @param v virtqueue it operates on
+ * @param cb callback invoked from the interrupt handler
+ * @param cb_opaque opaque value that will be passed to the cb
+ */
+void virtq_set_polled(struct virtq *v, virtq_notify_callback cb, void *cb_opaque);
+
+/**
+ * @brief asks the device to interrupt or not when it returns descriptor chains
+ *
+ * This is only a hint for the device (see spec 2.7.7), the driver has to check for
+ * returned descriptor chains after enabling the interrupt again
+ *
+ * @param v virtqueue it operates on
+ * @param enable whether the device should interrupt
+ */
+void virtq_enable_interrupt(struct virtq *v, bool enable);
+
 /**
  * @}
  */
@@ -1164,6 +1164,25 @@ __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 __syscall void k_thread_absolute_deadline_set(k_tid_t thread, int deadline);
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the timeout slack of a thread
+ *
+ * The timeouts of the thread, e.g. when it sleeps or pends on a kernel
+ * object with a timeout, may then expire up to @a slack later than
+ * requested, so that they can be handled by the same timer interrupt as
+ * other timeouts expiring around the same time. The slack of a thread is
+ * zero when it is created.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @param thread Thread to set the slack of
+ * @param slack Maximum delay of the timeouts of the thread, or K_NO_WAIT
+ *              for none
+ */
+__syscall void k_thread_timeout_slack_set(k_tid_t thread, k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Invoke the scheduler
  *
@@ -2116,6 +2135,25 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a timer.
+ *
+ * The expiries of the timer may then happen up to @a slack later than
+ * requested, so that they can be handled by the same timer interrupt as
+ * other timeouts expiring around the same time. The slack applies from the
+ * next time the timer is started. As each period of a periodic timer is
+ * counted from the previous expiry, such a timer may drift by up to
+ * @a slack per period.
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @param timer Address of timer.
+ * @param slack Maximum delay of the expiries, or K_NO_WAIT for none.
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @} */
 
 /**
@@ -2254,6 +2292,10 @@ struct k_queue {
 	sys_sflist_t data_q;
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
+#ifdef CONFIG_QUEUE_LOCKLESS
+	atomic_ptr_t incoming;
+	atomic_t waiters;
+#endif /* CONFIG_QUEUE_LOCKLESS */
 
 	Z_DECL_POLL_EVENT
 
@@ -2441,6 +2483,23 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a count data items from the head of @a queue
+ * while holding the queue lock once, instead of once per item. It does not
+ * wait for data items to become available.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Array receiving the addresses of the data items.
+ * @param count Maximum number of data items to get.
+ *
+ * @return Number of data items stored in @a data.
+ */
+size_t k_queue_get_bulk(struct k_queue *queue, void **data, size_t count);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2492,6 +2551,12 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (atomic_ptr_get(&queue->incoming) != NULL) {
+		return 0;
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	return sys_sflist_is_empty(&queue->data_q) ? 1 : 0;
 }
 
@@ -3853,6 +3918,8 @@ void k_ipi_work_signal(void);
 
 struct k_work_delayable;
 struct k_work_sync;
+struct k_work_q_worker;
+struct k_work_queue_deadline_stats;
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3952,6 +4019,33 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+/** @brief Submit a work item to a queue with a deadline.
+ *
+ * Same as k_work_submit_to_queue(), except that the item is queued in
+ * earliest deadline first order: ahead of the items with a later deadline
+ * and of all the items submitted without one, which keep their submission
+ * order.  The thread running the item gets its deadline, see
+ * k_thread_deadline_set(), so that it is scheduled earliest deadline first
+ * against the other threads of the same priority.
+ *
+ * The deadline of an item that is already queued is not changed.  A
+ * later submission without a deadline clears it.  Items completing after
+ * their deadline are counted, see k_work_queue_deadline_stats_get().
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_DEADLINE}
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the item should run.
+ * @param work pointer to the work item.
+ * @param deadline time in hardware cycles from now, as for
+ *        k_thread_deadline_set()
+ *
+ * @return as with k_work_submit_to_queue().
+ */
+int k_work_submit_with_deadline(struct k_work_q *queue, struct k_work *work,
+				int deadline);
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4078,17 +4172,97 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+/** @brief Initialize a work queue served by a pool of threads.
+ *
+ * This configures a work queue run by @p num_workers threads and starts
+ * them running.  Each worker has its own list of pending work items:
+ * work submitted from a worker is queued to it, other work to the worker
+ * matching the submitting CPU.  Idle workers steal the oldest items of
+ * the other workers, so the items of a queue may run concurrently and
+ * complete in any order.
+ *
+ * Any given work item is still run by a single worker at a time, and
+ * the submission, flush, cancellation and busy state semantics are the
+ * same as those of a queue with a single thread.  Work item duration
+ * monitoring (CONFIG_WORKQUEUE_WORK_TIMEOUT) is not supported.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_POOL}
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param workers array of @p num_workers worker structures.
+ *
+ * @param num_workers number of worker threads, at least 1.
+ *
+ * @param stacks stacks of the workers, defined with
+ *        K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param stack_size size of each stack, as passed to
+ *        K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param prio initial priority of the worker threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.  The name is given to all the worker threads.
+ */
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+
+/** @brief Get the deadline statistics of a work queue.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_DEADLINE}
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the queue structure.
+ * @param stats pointer to memory into which to copy the statistics.
+ */
+void k_work_queue_deadline_stats_get(struct k_work_q *queue,
+				     struct k_work_queue_deadline_stats *stats);
+
+/** @brief Reset the deadline statistics of a work queue.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_DEADLINE}
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the queue structure.
+ */
+void k_work_queue_deadline_stats_reset(struct k_work_q *queue);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
  * items it will process are expected to use.
  *
+ * For a queue served by a pool of threads this is the thread of the
+ * first worker. Use k_work_queue_thread_is_current() to check whether the
+ * caller runs on the queue.
+ *
  * @param queue pointer to the queue structure.
  *
  * @return the thread associated with the work queue.
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+/** @brief Check whether the current thread animates a work queue.
+ *
+ * For a queue served by a pool of threads, this is true on any of the
+ * workers.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the queue structure.
+ *
+ * @return true if the current thread is a thread of @p queue.
+ */
+bool k_work_queue_thread_is_current(struct k_work_q *queue);
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -4446,6 +4620,9 @@ enum {
 	K_WORK_DELAYABLE_BIT = 8,
 	K_WORK_DELAYABLE = BIT(K_WORK_DELAYABLE_BIT),
 
+	/* Work item submitted with a deadline */
+	K_WORK_DEADLINE_BIT = 9,
+
 	/* Dynamic work queue flags */
 	K_WORK_QUEUE_STARTED_BIT = 0,
 	K_WORK_QUEUE_STARTED = BIT(K_WORK_QUEUE_STARTED_BIT),
@@ -4523,6 +4700,11 @@ struct k_work {
 	 * It can be RUNNING and CANCELING simultaneously.
 	 */
 	uint32_t flags;
+
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+	/* Absolute deadline in cycles, valid with K_WORK_DEADLINE_BIT. */
+	uint32_t deadline;
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
 };
 
 #define Z_WORK_INITIALIZER(work_handler) { \
@@ -4661,6 +4843,49 @@ struct k_work_queue_config {
 	 * an error will be logged if CONFIG_LOG is enabled.
 	 */
 	uint32_t work_timeout_ms;
+
+	/** Control whether the workers of a work queue pool are pinned
+	 * to CPUs.
+	 *
+	 * If @c true, and CONFIG_SCHED_CPU_MASK is enabled, the worker
+	 * threads started by k_work_queue_pool_start() are pinned to the
+	 * CPUs in turn, so that work submitted from a CPU is run on it
+	 * unless another worker steals it.  Ignored by the other work
+	 * queues.
+	 */
+	bool pin_workers;
+};
+
+/** @brief Deadline statistics of a work queue.
+ *
+ * Only the work items submitted with k_work_submit_with_deadline() are
+ * accounted.
+ */
+struct k_work_queue_deadline_stats {
+	/** Number of items that completed */
+	uint32_t completed;
+
+	/** Number of items that completed after their deadline */
+	uint32_t missed;
+};
+
+/** @brief A worker thread of a work queue pool.
+ *
+ * Instances are provided to k_work_queue_pool_start(), one per worker
+ * thread, and must persist as long as the work queue runs.
+ */
+struct k_work_q_worker {
+	/* The thread of the worker. */
+	struct k_thread thread;
+
+	/* The pool the worker belongs to. */
+	struct k_work_q *queue;
+
+	/* Work items queued to the worker, that idle workers may steal. */
+	sys_slist_t pending;
+
+	/* Work item the worker is running, or NULL if idle. */
+	struct k_work *current;
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4694,6 +4919,30 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* Workers of a pool, NULL if the queue has a single thread.
+	 * The pending list is then unused.
+	 */
+	struct k_work_q_worker *workers;
+
+	/* Number of workers. */
+	uint8_t num_workers;
+
+	/* Number of workers running a work item. */
+	uint8_t num_busy;
+
+	/* Number of workers that exited once the queue was stopped. */
+	uint8_t num_exited;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+	/* Work items with a deadline that completed, and that missed it.
+	 * Updated without the work lock by the work queue threads.
+	 */
+	atomic_t deadline_completed;
+	atomic_t deadline_missed;
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -5678,6 +5927,14 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+struct z_mem_slab_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5685,6 +5942,11 @@ struct k_mem_slab {
 	char *free_list;
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	bool cache_bypass;
+	struct z_mem_slab_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5882,6 +6144,10 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/** @cond INTERNAL_HIDDEN */
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab);
+/** @endcond */
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5896,7 +6162,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	return z_mem_slab_num_used_get(slab);
+#else
 	return slab->info.num_used;
+#endif
 }
 
 /**
@@ -5935,7 +6205,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -6196,6 +6466,209 @@ int k_heap_array_get(struct k_heap **heap);
  * @}
  */
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Header of a chunk allocated by an arena from its heap */
+struct z_arena_chunk {
+	struct z_arena_chunk *next;
+};
+
+/**
+ * @endcond
+ */
+
+/**
+ * @defgroup arena_apis Memory Arena APIs
+ * @brief Bump allocation with a single release of all the allocated memory
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Memory arena structure
+ *
+ * An arena hands out memory from a buffer by bumping a pointer, and gives
+ * all of it back at once with k_arena_reset(). It is meant for short-lived
+ * allocations sharing the same lifetime, such as the ones made to process
+ * a single request. An arena may be given a k_heap to allocate more memory
+ * from when its buffer is exhausted.
+ */
+struct k_arena {
+	struct k_spinlock lock;
+	char *buffer;
+	size_t size;
+	char *cur;
+	char *end;
+	struct k_heap *heap;
+	size_t chunk_size;
+	struct z_arena_chunk *chunks;
+	size_t capacity;
+	size_t max_allocated;
+
+#ifdef CONFIG_OBJ_CORE_ARENA
+	struct k_obj_core obj_core;
+#endif /* CONFIG_OBJ_CORE_ARENA */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_ARENA_INITIALIZER(_arena, _arena_buffer, _arena_size) \
+	{                                                       \
+	.lock = {},                                             \
+	.buffer = _arena_buffer,                                \
+	.size = _arena_size,                                    \
+	.cur = _arena_buffer,                                   \
+	.end = (_arena_buffer) + (_arena_size),                 \
+	.heap = NULL,                                           \
+	.chunk_size = 0,                                        \
+	.chunks = NULL,                                         \
+	.capacity = _arena_size,                                \
+	.max_allocated = 0,                                     \
+	}
+
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a memory arena.
+ *
+ * The arena's buffer is @a arena_size bytes long and is aligned to a
+ * pointer boundary. After kernel start, &name can be used as if
+ * k_arena_init() had been called.
+ *
+ * @param name Name of the memory arena.
+ * @param arena_size Size of the arena's buffer (in bytes).
+ */
+#define K_ARENA_DEFINE(name, arena_size)                                        \
+	char __noinit_named(k_arena_buf_##name)                                 \
+		__aligned(sizeof(void *)) _k_arena_buf_##name[arena_size];      \
+	STRUCT_SECTION_ITERABLE(k_arena, name) =                                \
+		Z_ARENA_INITIALIZER(name, _k_arena_buf_##name, arena_size)
+
+/**
+ * @brief Statically define and initialize a memory arena in a private
+ * (static) scope.
+ *
+ * Same as K_ARENA_DEFINE(), except the arena and its buffer are static.
+ *
+ * @param name Name of the memory arena.
+ * @param arena_size Size of the arena's buffer (in bytes).
+ */
+#define K_ARENA_DEFINE_STATIC(name, arena_size)                                 \
+	static char __noinit_named(k_arena_buf_##name)                          \
+		__aligned(sizeof(void *)) _k_arena_buf_##name[arena_size];      \
+	static STRUCT_SECTION_ITERABLE(k_arena, name) =                         \
+		Z_ARENA_INITIALIZER(name, _k_arena_buf_##name, arena_size)
+
+/**
+ * @brief Initialize a memory arena.
+ *
+ * Initializes an arena handing out memory from @a buffer. The buffer may
+ * be NULL, with a @a size of zero, when all the memory of the arena comes
+ * from a heap set with k_arena_heap_set().
+ *
+ * @param arena Address of the memory arena.
+ * @param buffer Pointer to buffer used for the allocations.
+ * @param size Size of the buffer (in bytes).
+ */
+void k_arena_init(struct k_arena *arena, void *buffer, size_t size);
+
+/**
+ * @brief Let a memory arena grow from a heap.
+ *
+ * Once its buffer is exhausted, the arena allocates chunks of at least
+ * @a chunk_size bytes from @a heap, without waiting, and keeps bumping
+ * a pointer through them. The chunks are given back to the heap by
+ * k_arena_reset(). Passing a NULL heap stops the arena from growing.
+ * The heap may only be changed while the arena has no chunk, that is
+ * before its first allocation or right after a reset.
+ *
+ * @param arena Address of the memory arena.
+ * @param heap Heap to allocate the chunks from, or NULL.
+ * @param chunk_size Minimum size of the chunks (in bytes).
+ */
+void k_arena_heap_set(struct k_arena *arena, struct k_heap *heap, size_t chunk_size);
+
+/**
+ * @brief Allocate aligned memory from a memory arena.
+ *
+ * The memory cannot be freed on its own, it is given back with all the
+ * other allocations of the arena by k_arena_reset().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param arena Address of the memory arena.
+ * @param align Alignment of the allocated memory, a power of two.
+ * @param bytes Number of bytes to allocate.
+ *
+ * @return Address of the allocated memory, or NULL if @a bytes is zero or
+ *         if neither the arena nor its heap have enough free memory.
+ */
+void *k_arena_aligned_alloc(struct k_arena *arena, size_t align, size_t bytes);
+
+/**
+ * @brief Allocate memory from a memory arena.
+ *
+ * Same as k_arena_aligned_alloc(), with the memory aligned to a pointer
+ * boundary.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param arena Address of the memory arena.
+ * @param bytes Number of bytes to allocate.
+ *
+ * @return Address of the allocated memory, or NULL on failure.
+ */
+static inline void *k_arena_alloc(struct k_arena *arena, size_t bytes)
+{
+	return k_arena_aligned_alloc(arena, sizeof(void *), bytes);
+}
+
+/**
+ * @brief Release all the memory allocated from a memory arena.
+ *
+ * All the memory previously allocated from the arena becomes invalid and
+ * the chunks allocated from its heap are given back to the heap.
+ *
+ * @param arena Address of the memory arena.
+ */
+void k_arena_reset(struct k_arena *arena);
+
+/**
+ * @brief Get the memory stats for a memory arena
+ *
+ * The allocated bytes include the alignment padding and the space left
+ * unused at the end of the buffer or of a chunk when the arena moved to a
+ * new chunk. The free bytes are the ones that can be allocated without
+ * growing the arena.
+ *
+ * @param arena Address of the memory arena.
+ * @param stats Pointer to memory into which to copy memory usage statistics
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_arena_runtime_stats_get(struct k_arena *arena, struct sys_memory_stats *stats);
+
+/**
+ * @brief Reset the maximum memory usage for a memory arena
+ *
+ * The maximum allocated bytes are set to the currently allocated bytes.
+ *
+ * @param arena Address of the memory arena.
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Memory arena is NULL
+ */
+int k_arena_runtime_stats_reset_max(struct k_arena *arena);
+
+/** @} */
+
 /**
  * @defgroup heap_apis Heap APIs
  * @brief Memory allocation from the Heap
@@ -27,6 +27,8 @@
 
 /* Known kernel object types */
 
+/** Memory arena object type */
+#define K_OBJ_TYPE_ARENA_ID      K_OBJ_TYPE_ID_GEN("AREN")
 /** Condition variable object type */
 #define K_OBJ_TYPE_CONDVAR_ID    K_OBJ_TYPE_ID_GEN("COND")
 /** CPU object type */
@@ -51,6 +53,8 @@
 #define K_OBJ_TYPE_MUTEX_ID      K_OBJ_TYPE_ID_GEN("MUTX")
 /** Pipe object type */
 #define K_OBJ_TYPE_PIPE_ID       K_OBJ_TYPE_ID_GEN("PIPE")
+/** Scheduler histograms object type */
+#define K_OBJ_TYPE_SCHED_ID      K_OBJ_TYPE_ID_GEN("SCHD")
 /** Semaphore object type */
 #define K_OBJ_TYPE_SEM_ID        K_OBJ_TYPE_ID_GEN("SEM4")
 /** Stack object type */
@@ -30,4 +30,40 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_SCHED_HISTOGRAM) || defined(__DOXYGEN__)
+/**
+ * Number of buckets of a scheduler histogram.
+ */
+#define K_SCHED_HISTOGRAM_BUCKETS CONFIG_SCHED_HISTOGRAM_BUCKETS
+
+/**
+ * Histogram of durations, in cycles, measured by the scheduler.
+ *
+ * Bucket 0 counts the durations of 0 cycles, and bucket @a n counts the
+ * durations of [2^(n-1), 2^n) cycles. The last bucket also counts all the
+ * longer durations.
+ */
+struct k_sched_histogram {
+	uint32_t  buckets[K_SCHED_HISTOGRAM_BUCKETS]; /**< Samples per bucket */
+	uint32_t  count;        /**< \# of samples */
+	uint32_t  max;          /**< Longest duration in cycles */
+	uint64_t  total;        /**< Sum of the durations in cycles */
+};
+
+/**
+ * Scheduler histograms, collected per CPU when CONFIG_SCHED_HISTOGRAM is
+ * selected.
+ */
+struct k_sched_histograms {
+	/** Time threads spend ready in the run queue before being switched in */
+	struct k_sched_histogram  runq_wait;
+	/** Time between switching a thread out and switching the next one in */
+	struct k_sched_histogram  switch_latency;
+	/** Time between a thread being made ready by an ISR and it running */
+	struct k_sched_histogram  isr_wake;
+	/** Time the scheduler spinlock is held */
+	struct k_sched_histogram  lock_hold;
+};
+#endif /* CONFIG_SCHED_HISTOGRAM */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
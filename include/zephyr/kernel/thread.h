@@ -131,6 +131,14 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_HISTOGRAM
+	/* Cycle count at which the thread was last made ready */
+	uint32_t ready_stamp;
+
+	/* Whether ready_stamp is valid, and whether it was set in an ISR */
+	uint8_t ready_flags;
+#endif /* CONFIG_SCHED_HISTOGRAM */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -207,6 +207,11 @@ enum ethernet_hw_caps {
 
 	/** TX-Injection supported */
 	ETHERNET_TXINJECTION_MODE	= BIT(20),
+
+	/** TCP segmentation offload (TSO) supported, packets larger than the
+	 * MTU are segmented by the device according to net_pkt_gso_size().
+	 */
+	ETHERNET_HW_TSO			= BIT(21),
 };
 
 /** @cond INTERNAL_HIDDEN */
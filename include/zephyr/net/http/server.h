@@ -392,8 +392,8 @@ struct http_header_capture_ctx {
 	/** Number of headers captured */
 	size_t count;
 
-	/** Current position in buffer */
-	size_t cursor;
+	/** Arena handing out the buffer, reset for each request */
+	struct k_arena arena;
 
 	/** The HTTP2 stream associated with the current headers */
 	struct http2_stream_ctx *current_stream;
@@ -129,6 +129,87 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_NAPI) || defined(__DOXYGEN__)
+struct net_napi;
+
+/**
+ * @brief Poll function of a network device driver.
+ *
+ * @details Receive at most @p budget packets with net_napi_receive(). If
+ * fewer packets are pending, call net_napi_complete() and enable the
+ * receive interrupt again.
+ *
+ * @param napi Poll context of the device.
+ * @param budget Maximum number of packets to receive.
+ *
+ * @return Number of packets received.
+ */
+typedef int (*net_napi_poll_t)(struct net_napi *napi, int budget);
+
+/**
+ * @brief Poll context of a network device receiving its packets by polling.
+ *
+ * @details Instead of giving each packet to net_recv_data() from its
+ * interrupt handler, the driver disables its receive interrupt and calls
+ * net_napi_schedule(). The stack then calls its poll function from the
+ * network poll thread until there are no more packets to receive.
+ */
+struct net_napi {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	struct net_if *iface;
+	net_napi_poll_t poll;
+	atomic_t scheduled;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize the poll context of a network device.
+ *
+ * @param napi Poll context to initialize.
+ * @param iface Network interface of the device.
+ * @param poll Poll function of the driver.
+ */
+void net_napi_init(struct net_napi *napi, struct net_if *iface, net_napi_poll_t poll);
+
+/**
+ * @brief Schedule the polling of a network device.
+ *
+ * @details Called by the driver, usually from its interrupt handler after
+ * disabling its receive interrupt. Does nothing if the polling is already
+ * scheduled.
+ *
+ * @param napi Poll context of the device.
+ */
+void net_napi_schedule(struct net_napi *napi);
+
+/**
+ * @brief Mark the polling of a network device as complete.
+ *
+ * @details Called by the poll function when it received fewer packets than
+ * its budget, before it enables the receive interrupt again. Packets that
+ * arrived before the interrupt was enabled must be checked for afterwards,
+ * and the polling scheduled again if there are some.
+ *
+ * @param napi Poll context of the device.
+ */
+void net_napi_complete(struct net_napi *napi);
+
+/**
+ * @brief Push a packet received by a poll function up in the network stack.
+ *
+ * @details The packet is processed at once in the context of the poll
+ * function, instead of being queued to a traffic class RX queue.
+ *
+ * @param napi Poll context of the device.
+ * @param pkt Network packet data.
+ *
+ * @return 0 if ok, <0 if error, in which case the caller needs to unref
+ * the packet.
+ */
+int net_napi_receive(struct net_napi *napi, struct net_pkt *pkt);
+#endif /* CONFIG_NET_NAPI */
+
 /**
  * @brief Try sending data to network.
  *
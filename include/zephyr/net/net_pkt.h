@@ -361,6 +361,20 @@ struct net_pkt {
 	uint8_t ipv4_pmtu : 1;
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_GSO)
+	/* Payload size of the segments this packet is to be cut into,
+	 * 0 if the packet is sent as is.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_GSO */
+
+#if defined(CONFIG_NET_GRO)
+	/* Number of received TCP segments merged in this packet, their
+	 * checksums are verified already. 0 if not handled by GRO.
+	 */
+	uint8_t gro_segs;
+#endif /* CONFIG_NET_GRO */
+
 	/* @endcond */
 };
 
@@ -873,6 +887,56 @@ static inline void net_pkt_set_ipv4_pmtu(struct net_pkt *pkt, bool value)
 }
 #endif /* CONFIG_NET_IPV4_PMTU */
 
+#if defined(CONFIG_NET_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	pkt->gso_size = gso_size;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(gso_size);
+}
+#endif /* CONFIG_NET_GSO */
+
+#if defined(CONFIG_NET_GRO)
+static inline uint8_t net_pkt_gro_segs(struct net_pkt *pkt)
+{
+	return pkt->gro_segs;
+}
+
+static inline void net_pkt_set_gro_segs(struct net_pkt *pkt, uint8_t segs)
+{
+	pkt->gro_segs = segs;
+}
+#else
+static inline uint8_t net_pkt_gro_segs(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gro_segs(struct net_pkt *pkt, uint8_t segs)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(segs);
+}
+#endif /* CONFIG_NET_GRO */
+
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
 static inline uint16_t net_pkt_ipv4_fragment_offset(struct net_pkt *pkt)
 {
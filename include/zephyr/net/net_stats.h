@@ -165,6 +165,14 @@ struct net_stats_tcp {
 	/** Number of retransmitted TCP segments. */
 	net_stats_t rexmit;
 
+	/** Number of fast retransmissions, triggered by duplicate or
+	 * selective ACKs.
+	 */
+	net_stats_t fast_rexmit;
+
+	/** Number of retransmission timeouts. */
+	net_stats_t rto;
+
 	/** Number of dropped connection attempts because too few connections
 	 * were available.
 	 */
@@ -1193,6 +1201,20 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_RESET_WIFI);
 		NET_STATS_GET_COLLECTOR_NAME(dev_id, sfx),		\
 		NET_STATS_GET_VAR(dev_id, sfx, tcp_rexmit),		\
 		&(iface)->stats.tcp.rexmit);				\
+	NET_STATS_PROMETHEUS_COUNTER_DEFINE(				\
+		"TCP fast retransmissions",				\
+		NET_STATS_GET_INSTANCE(dev_id, sfx, tcp_fast_rexmit),	\
+		"packet_count",						\
+		NET_STATS_GET_COLLECTOR_NAME(dev_id, sfx),		\
+		NET_STATS_GET_VAR(dev_id, sfx, tcp_fast_rexmit),	\
+		&(iface)->stats.tcp.fast_rexmit);			\
+	NET_STATS_PROMETHEUS_COUNTER_DEFINE(				\
+		"TCP retransmission timeouts",				\
+		NET_STATS_GET_INSTANCE(dev_id, sfx, tcp_rto),		\
+		"packet_count",						\
+		NET_STATS_GET_COLLECTOR_NAME(dev_id, sfx),		\
+		NET_STATS_GET_VAR(dev_id, sfx, tcp_rto),		\
+		&(iface)->stats.tcp.rto);				\
 	NET_STATS_PROMETHEUS_COUNTER_DEFINE(				\
 		"TCP reset received",					\
 		NET_STATS_GET_INSTANCE(dev_id, sfx, tcp_rst_recv),	\
@@ -996,9 +996,25 @@ int zsock_sendmsg_all(int sock, const struct net_msghdr *msg, int flags,
 #define ZSOCK_TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define ZSOCK_TCP_KEEPCNT 4
+/** Name of the congestion control algorithm (string) */
+#define ZSOCK_TCP_CONGESTION 5
+/** Congestion control state of the connection (struct zsock_tcp_info, read only) */
+#define ZSOCK_TCP_INFO 6
 
 /** @} */
 
+/**
+ * @brief Congestion control state of a TCP connection
+ *
+ * Returned by the @ref ZSOCK_TCP_INFO socket option.
+ */
+struct zsock_tcp_info {
+	uint32_t cwnd;       /**< Congestion window, in bytes */
+	uint32_t ssthresh;   /**< Slow start threshold, in bytes */
+	uint32_t srtt_ms;    /**< Smoothed round trip time, 0 if not measured yet */
+	uint32_t min_rtt_ms; /**< Minimum round trip time, 0 if not measured yet */
+};
+
 /**
  * @name IPv4 level options (NET_IPPROTO_IP)
  * @{
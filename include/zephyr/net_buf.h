@@ -1470,6 +1470,32 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate several variable length buffers from a pool.
+ *
+ * Allocate up to @p count buffers in one go, taking the lock of the free
+ * buffer queue only once for the whole batch. This is meant for drivers
+ * refilling many receive descriptors at once.
+ *
+ * The buffers that are readily available are allocated without waiting.
+ * Only if none is available, the allocation waits for one buffer, as
+ * specified by @p timeout. Fewer than @p count buffers may be allocated.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array receiving the allocated buffers.
+ * @param count Number of buffers to allocate.
+ * @param timeout Affects the action taken should the pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait until the specified
+ *        timeout.
+ *
+ * @return Number of buffers allocated and stored at the start of @p bufs.
+ */
+size_t __must_check net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+				       struct net_buf **bufs, size_t count,
+				       k_timeout_t timeout);
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1577,6 +1603,20 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line);
 void net_buf_unref(struct net_buf *buf);
 #endif
 
+/**
+ * @brief Decrements the reference count of several buffers.
+ *
+ * Same as calling net_buf_unref() on each buffer of @p bufs, including
+ * their fragments, but the buffers that reach a reference count of zero
+ * are put back into their pool in one operation for each run of buffers
+ * from the same pool.
+ *
+ * @param bufs Array of pointers on buffers. NULL entries are allowed and
+ *        skipped, so that a partially filled array can be released.
+ * @param count Number of entries in @p bufs
+ */
+void net_buf_unref_chain_bulk(struct net_buf **bufs, size_t count);
+
 /**
  * @brief Increment the reference count of a buffer.
  *
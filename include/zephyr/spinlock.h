@@ -116,6 +116,15 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+/* The scheduler histograms measure how long the scheduler spinlock is held,
+ * the hooks are only called for that lock.
+ */
+#ifdef CONFIG_SCHED_HISTOGRAM
+extern struct k_spinlock _sched_spinlock;
+void z_sched_hist_lock_acquired(void);
+void z_sched_hist_lock_released(void);
+#endif /* CONFIG_SCHED_HISTOGRAM */
+
 /**
  * @brief Spinlock key type
  *
@@ -149,6 +158,21 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 	l->lock_time = sys_clock_cycle_get_32();
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+#ifdef CONFIG_SCHED_HISTOGRAM
+	if (l == &_sched_spinlock) {
+		z_sched_hist_lock_acquired();
+	}
+#endif /* CONFIG_SCHED_HISTOGRAM */
+}
+
+static ALWAYS_INLINE void z_spinlock_release_pre(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SCHED_HISTOGRAM
+	if (l == &_sched_spinlock) {
+		z_sched_hist_lock_released();
+	}
+#endif /* CONFIG_SCHED_HISTOGRAM */
 }
 
 /**
@@ -315,6 +339,7 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+	z_spinlock_release_pre(l);
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
@@ -365,6 +390,7 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+	z_spinlock_release_pre(l);
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
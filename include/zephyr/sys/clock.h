@@ -276,6 +276,34 @@ int64_t sys_clock_tick_get(void);
 #define sys_clock_tick_get_32() (0)
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Kernel timeout statistics
+ *
+ * @see sys_clock_timeout_stats_get()
+ */
+struct sys_clock_timeout_stats {
+	/** Number of timeouts which expired */
+	uint64_t expired;
+	/**
+	 * Number of timeouts which expired in the same timer announcement as
+	 * an earlier timeout, without needing a timer interrupt of their own
+	 */
+	uint64_t coalesced;
+	/** Number of timeouts whose expiry was moved later within their slack */
+	uint64_t deferred;
+};
+
+/**
+ * @brief Get the kernel timeout statistics
+ *
+ * @kconfig_dep{CONFIG_TIMEOUT_SLACK}
+ *
+ * @param stats Filled with the statistics accumulated since boot
+ */
+void sys_clock_timeout_stats_get(struct sys_clock_timeout_stats *stats);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 
 /**
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_
+#define ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_SYS_HEAP_PROFILER) || defined(__DOXYGEN__)
+
+/**
+ * @defgroup heap_profiler_apis Heap Profiler APIs
+ * @ingroup heaps
+ * @{
+ */
+
+/**
+ * @brief Allocation site of the sys_heap profiler
+ *
+ * The counts and bytes are the ones of the sampled allocations, each of
+ * them stands for CONFIG_SYS_HEAP_PROFILER_PERIOD allocations.
+ */
+struct sys_heap_profiler_site {
+	/** Return addresses of the site, innermost first */
+	uintptr_t pcs[CONFIG_SYS_HEAP_PROFILER_DEPTH];
+	/** Number of valid entries in @a pcs */
+	uint8_t depth;
+	/** Number of sampled blocks still allocated */
+	uint32_t live_count;
+	/** Bytes of the sampled blocks still allocated */
+	size_t live_bytes;
+	/** Number of sampled allocations */
+	uint32_t alloc_count;
+	/** Bytes of the sampled allocations */
+	uint64_t alloc_bytes;
+};
+
+/**
+ * @brief Callback receiving the lines of a heap profile
+ *
+ * @param line NULL-terminated line, without the trailing newline
+ * @param user_data Pointer passed to sys_heap_profiler_dump()
+ */
+typedef void (*sys_heap_profiler_line_cb_t)(const char *line, void *user_data);
+
+/**
+ * @brief Get an allocation site of the heap profiler
+ *
+ * The sites are stored in a table of CONFIG_SYS_HEAP_PROFILER_SITES
+ * entries, some of which may be unused.
+ *
+ * @param index Index of the site in the table
+ * @param site Pointer to memory into which to copy the site
+ *
+ * @retval 0 Success
+ * @retval -ENOENT The entry is unused
+ * @retval -EINVAL The index is out of the table
+ */
+int sys_heap_profiler_site_get(unsigned int index, struct sys_heap_profiler_site *site);
+
+/**
+ * @brief Get the number of dropped samples
+ *
+ * Samples are dropped when the table of allocation sites or the table of
+ * the live sampled blocks is full.
+ *
+ * @return Number of samples dropped since the last reset
+ */
+uint32_t sys_heap_profiler_dropped_get(void);
+
+/**
+ * @brief Reset the heap profiler
+ *
+ * Clears the cumulative counts of all the sites and the dropped samples
+ * counter. The sites without live sampled blocks are released, the live
+ * blocks keep being tracked.
+ */
+void sys_heap_profiler_reset(void);
+
+/**
+ * @brief Dump the heap profile
+ *
+ * Emits the profile in the legacy text format of pprof heap profiles,
+ * one line at a time. The counts and bytes are scaled by the sampling
+ * period, the addresses are symbolized by pprof from the Zephyr ELF file.
+ *
+ * @param cb Callback receiving each line
+ * @param user_data Pointer passed to @a cb
+ */
+void sys_heap_profiler_dump(sys_heap_profiler_line_cb_t cb, void *user_data);
+
+/**
+ * @brief Dump the heap profile to a buffer
+ *
+ * Same as sys_heap_profiler_dump(), with the lines written to @a buf,
+ * each terminated by a newline, for instance to a retained memory region
+ * read after a reset. The output is truncated to whole lines if the
+ * buffer is too small.
+ *
+ * @param buf Buffer receiving the profile, NULL-terminated
+ * @param size Size of the buffer
+ *
+ * @return Length of the profile written to @a buf
+ */
+size_t sys_heap_profiler_dump_buf(char *buf, size_t size);
+
+/** @} */
+
+#endif /* CONFIG_SYS_HEAP_PROFILER */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H_ */
@@ -31,7 +31,8 @@ typedef void (*k_p4wq_done_handler_t)(struct k_p4wq_work *work);
  * User-populated struct representing a single work item.  The
  * priority and deadline fields are interpreted as thread scheduling
  * priorities, exactly as per k_thread_priority_set() and
- * k_thread_deadline_set().
+ * k_thread_deadline_set(). A deadline of zero, the default, means the
+ * item has no deadline to meet.
  */
 struct k_p4wq_work {
 	/* Filled out by submitting code */
@@ -48,6 +49,7 @@ struct k_p4wq_work {
 	};
 	struct k_thread *thread;
 	struct k_p4wq *queue;
+	bool has_deadline;
 };
 
 #define K_P4WQ_QUEUE_PER_THREAD		BIT(0)
@@ -86,6 +88,10 @@ struct k_p4wq {
 	 * and k_p4wq_work is not needed by p4wq anymore
 	 */
 	k_p4wq_done_handler_t done_handler;
+
+	/* Work items with a deadline that completed, and that missed it */
+	uint32_t completed;
+	uint32_t deadline_misses;
 };
 
 struct k_p4wq_initparam {
@@ -237,6 +243,26 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item);
  */
 bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item);
 
+/**
+ * @brief Get the deadline statistics of a P4 queue
+ *
+ * Counts the work items with a non-zero deadline that completed since
+ * the queue was initialized or the statistics reset, and those of them
+ * that completed after their deadline.
+ *
+ * @param queue P4 Queue
+ * @param stats Pointer to memory into which to copy the statistics
+ */
+void k_p4wq_deadline_stats_get(struct k_p4wq *queue,
+			       struct k_work_queue_deadline_stats *stats);
+
+/**
+ * @brief Reset the deadline statistics of a P4 queue
+ *
+ * @param queue P4 Queue
+ */
+void k_p4wq_deadline_stats_reset(struct k_p4wq *queue);
+
 /**
  * @brief Regain ownership of the work item, wait for completion if it's synchronous
  */
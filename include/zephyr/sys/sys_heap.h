@@ -150,6 +150,36 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes);
  */
 void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes);
 
+/** @brief Allocate memory from a sys_heap on behalf of a caller
+ *
+ * Same as sys_heap_noalign_alloc(), but with CONFIG_SYS_HEAP_PROFILER the
+ * allocation is charged to @a caller instead of to the return address of
+ * this function. This lets allocators built on top of sys_heap, such as
+ * k_heap_alloc() and k_malloc(), report the call sites of their own users.
+ *
+ * @param heap Heap from which to allocate
+ * @param align Ignored placeholder
+ * @param bytes Number of bytes requested
+ * @param caller Address the allocation is charged to
+ * @return Pointer to memory the caller can now use
+ */
+void *sys_heap_noalign_alloc_caller(struct sys_heap *heap, size_t align, size_t bytes,
+				    uintptr_t caller);
+
+/** @brief Allocate aligned memory from a sys_heap on behalf of a caller
+ *
+ * Same as sys_heap_aligned_alloc(), but charges the allocation to
+ * @a caller, see sys_heap_noalign_alloc_caller().
+ *
+ * @param heap Heap from which to allocate
+ * @param align Alignment in bytes, must be a power of two
+ * @param bytes Number of bytes requested
+ * @param caller Address the allocation is charged to
+ * @return Pointer to memory the caller can now use
+ */
+void *sys_heap_aligned_alloc_caller(struct sys_heap *heap, size_t align, size_t bytes,
+				    uintptr_t caller);
+
 /** @brief Free memory into a sys_heap
  *
  * De-allocates a pointer to memory previously returned from
@@ -184,6 +214,19 @@ void sys_heap_free(struct sys_heap *heap, void *mem);
  */
 void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes);
 
+/** @brief Expand the size of an existing allocation on behalf of a caller
+ *
+ * Same as sys_heap_realloc(), but charges the new block to @a caller,
+ * see sys_heap_noalign_alloc_caller().
+ *
+ * @param heap Heap from which to allocate
+ * @param ptr Original pointer returned from a previous allocation
+ * @param bytes Number of bytes requested for the new block
+ * @param caller Address the allocation is charged to
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_realloc_caller(struct sys_heap *heap, void *ptr, size_t bytes, uintptr_t caller);
+
 /** @brief Expand the size of an existing allocation
  *
  * Behaves in all ways like sys_heap_realloc(), except that the returned
@@ -1059,6 +1059,21 @@
  */
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)
 
+/**
+ * @brief Trace Queue bulk get enter
+ * @param queue Queue object
+ * @param count Maximum number of items
+ */
+#define sys_port_trace_k_queue_get_bulk_enter(queue, count)
+
+/**
+ * @brief Trace Queue bulk get exit
+ * @param queue Queue object
+ * @param count Maximum number of items
+ * @param ret Return value
+ */
+#define sys_port_trace_k_queue_get_bulk_exit(queue, count, ret)
+
 /**
  * @brief Trace Queue remove enter
  * @param queue Queue object
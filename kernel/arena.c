@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef CONFIG_OBJ_CORE_ARENA
+static struct k_obj_type obj_type_arena;
+
+#ifdef CONFIG_OBJ_CORE_STATS_ARENA
+static int arena_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	return k_arena_runtime_stats_get((struct k_arena *)obj_core->obj, stats);
+}
+
+static int arena_stats_query(struct k_obj_core *obj_core, void *stats)
+{
+	return k_arena_runtime_stats_get((struct k_arena *)obj_core->obj, stats);
+}
+
+static int arena_stats_reset(struct k_obj_core *obj_core)
+{
+	return k_arena_runtime_stats_reset_max((struct k_arena *)obj_core->obj);
+}
+
+static struct k_obj_core_stats_desc arena_stats_desc = {
+	.raw_size = sizeof(struct sys_memory_stats),
+	.query_size = sizeof(struct sys_memory_stats),
+	.raw = arena_stats_raw,
+	.query = arena_stats_query,
+	.reset = arena_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_ARENA */
+
+static void arena_obj_core_init(struct k_arena *arena)
+{
+	k_obj_core_init_and_link(K_OBJ_CORE(arena), &obj_type_arena);
+#ifdef CONFIG_OBJ_CORE_STATS_ARENA
+	k_obj_core_stats_register(K_OBJ_CORE(arena), arena, sizeof(struct sys_memory_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_ARENA */
+}
+
+static int init_arena_obj_core_list(void)
+{
+	/* Initialize arena object type */
+
+	z_obj_type_init(&obj_type_arena, K_OBJ_TYPE_ARENA_ID,
+			offsetof(struct k_arena, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_ARENA
+	k_obj_type_stats_init(&obj_type_arena, &arena_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_ARENA */
+
+	/* Initialize statically defined arenas */
+
+	STRUCT_SECTION_FOREACH(k_arena, arena) {
+		arena_obj_core_init(arena);
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_arena_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_ARENA */
+
+/* Bytes handed out, including the padding and the abandoned tails */
+static size_t allocated_locked(struct k_arena *arena)
+{
+	return arena->capacity - (size_t)(arena->end - arena->cur);
+}
+
+static void *bump(struct k_arena *arena, size_t align, size_t bytes)
+{
+	uintptr_t start = ROUND_UP((uintptr_t)arena->cur, align);
+
+	if ((start < (uintptr_t)arena->cur) || (start > (uintptr_t)arena->end) ||
+	    (bytes > (uintptr_t)arena->end - start)) {
+		return NULL;
+	}
+
+	arena->cur = (char *)start + bytes;
+
+	return (void *)start;
+}
+
+/* Move to a new chunk from the heap, large enough for the allocation */
+static bool chunk_add(struct k_arena *arena, size_t align, size_t bytes)
+{
+	size_t need = sizeof(struct z_arena_chunk) + (align - 1) + bytes;
+	struct z_arena_chunk *chunk;
+	size_t size;
+
+	if ((arena->heap == NULL) || (need < bytes)) {
+		return false;
+	}
+
+	size = MAX(need, arena->chunk_size);
+	chunk = k_heap_alloc(arena->heap, size, K_NO_WAIT);
+	if (chunk == NULL) {
+		return false;
+	}
+
+	/* The tail of the current chunk is left unused and counted as
+	 * allocated, the capacity grows by the whole new chunk.
+	 */
+	chunk->next = arena->chunks;
+	arena->chunks = chunk;
+	arena->capacity += size - sizeof(struct z_arena_chunk);
+	arena->cur = (char *)(chunk + 1);
+	arena->end = (char *)chunk + size;
+
+	return true;
+}
+
+void k_arena_init(struct k_arena *arena, void *buffer, size_t size)
+{
+	__ASSERT((buffer != NULL) || (size == 0), "arena buffer is NULL");
+
+	arena->lock = (struct k_spinlock) {};
+	arena->buffer = buffer;
+	arena->size = size;
+	arena->cur = buffer;
+	arena->end = (char *)buffer + size;
+	arena->heap = NULL;
+	arena->chunk_size = 0;
+	arena->chunks = NULL;
+	arena->capacity = size;
+	arena->max_allocated = 0;
+
+#ifdef CONFIG_OBJ_CORE_ARENA
+	arena_obj_core_init(arena);
+#endif /* CONFIG_OBJ_CORE_ARENA */
+}
+
+void k_arena_heap_set(struct k_arena *arena, struct k_heap *heap, size_t chunk_size)
+{
+	k_spinlock_key_t key = k_spin_lock(&arena->lock);
+
+	__ASSERT(arena->chunks == NULL, "arena heap changed with chunks allocated");
+
+	arena->heap = heap;
+	arena->chunk_size = chunk_size;
+
+	k_spin_unlock(&arena->lock, key);
+}
+
+void *k_arena_aligned_alloc(struct k_arena *arena, size_t align, size_t bytes)
+{
+	k_spinlock_key_t key;
+	void *mem;
+
+	__ASSERT((align != 0) && ((align & (align - 1)) == 0),
+		 "align must be a power of 2");
+
+	if (bytes == 0) {
+		return NULL;
+	}
+
+	key = k_spin_lock(&arena->lock);
+
+	mem = bump(arena, align, bytes);
+	if ((mem == NULL) && chunk_add(arena, align, bytes)) {
+		mem = bump(arena, align, bytes);
+	}
+
+	if (mem != NULL) {
+		arena->max_allocated = MAX(arena->max_allocated, allocated_locked(arena));
+	}
+
+	k_spin_unlock(&arena->lock, key);
+
+	return mem;
+}
+
+void k_arena_reset(struct k_arena *arena)
+{
+	struct z_arena_chunk *chunks;
+	struct k_heap *heap;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&arena->lock);
+
+	chunks = arena->chunks;
+	heap = arena->heap;
+	arena->chunks = NULL;
+	arena->cur = arena->buffer;
+	arena->end = arena->buffer + arena->size;
+	arena->capacity = arena->size;
+
+	k_spin_unlock(&arena->lock, key);
+
+	/* The chunks are no longer reachable from the arena, give them back
+	 * without holding its lock.
+	 */
+	while (chunks != NULL) {
+		struct z_arena_chunk *next = chunks->next;
+
+		__ASSERT(heap != NULL, "arena chunks without a heap");
+		k_heap_free(heap, chunks);
+		chunks = next;
+	}
+}
+
+int k_arena_runtime_stats_get(struct k_arena *arena, struct sys_memory_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF((arena == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&arena->lock);
+
+	stats->allocated_bytes = allocated_locked(arena);
+	stats->free_bytes = (size_t)(arena->end - arena->cur);
+	stats->max_allocated_bytes = arena->max_allocated;
+
+	k_spin_unlock(&arena->lock, key);
+
+	return 0;
+}
+
+int k_arena_runtime_stats_reset_max(struct k_arena *arena)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF(arena == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&arena->lock);
+
+	arena->max_allocated = allocated_locked(arena);
+
+	k_spin_unlock(&arena->lock, key);
+
+	return 0;
+}
@@ -177,14 +177,12 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
 
 	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
+		for (thread = data.head; thread != NULL;
+		     thread = thread->next_event_link) {
 			arch_thread_return_value_set(thread, 0);
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+		}
+
+		z_sched_wake_thread_list(data.head);
 	}
 
 	/* stash any events not consumed */
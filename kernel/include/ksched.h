@@ -227,30 +227,31 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
  */
 void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 
+/**
+ * Wakes a list of threads.
+ *
+ * Same as invoking z_sched_wake_thread() on every thread of a list linked
+ * through next_event_link, but holding _sched_spinlock only once and
+ * flagging the IPIs once for the whole list.
+ *
+ * @param head First thread of the list.
+ */
+void z_sched_wake_thread_list(struct k_thread *head);
+
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Same as invoking z_sched_wake() on all threads in the queue until there
+ * are no more to wake up, except that all the threads are woken up while
+ * holding _sched_spinlock once, and that the IPIs needed to run them on
+ * other CPUs are flagged once for the whole batch.
  *
- * @param wait_q Wait queue to wake up the highest prio thread
- * @param swap_retval Swap return value for woken thread
+ * @param wait_q Wait queue to wake up the threads of
+ * @param swap_retval Swap return value for woken threads
  * @param swap_data Data return value to supplement swap_retval. May be NULL.
- * @retval true If any threads were woken up
- * @retval false If the wait_q was empty
+ * @return Number of threads woken up, 0 if the wait_q was empty
  */
-static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
-				    void *swap_data)
-{
-	bool woken = false;
-
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
-	/* True if we woke at least one thread up */
-	return woken;
-}
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
 /**
  * Atomically put the current thread to sleep on a wait queue, with timeout
@@ -142,6 +142,18 @@ static inline bool z_is_thread_queued(const struct k_thread *thread)
 	return z_is_thread_state_set(thread, _THREAD_QUEUED);
 }
 
+#ifdef CONFIG_SMP
+/*
+ * Returns true if the thread is the current thread of one of the CPUs.
+ * Without _sched_spinlock held, this is only a hint as the thread may be
+ * switched out at any time.
+ */
+static inline bool z_is_thread_running(const struct k_thread *thread)
+{
+	return _kernel.cpus[thread->base.cpu].current == thread;
+}
+#endif /* CONFIG_SMP */
+
 static inline void z_mark_thread_as_queued(struct k_thread *thread)
 {
 	thread->base.thread_state |= _THREAD_QUEUED;
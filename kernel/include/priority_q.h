@@ -47,6 +47,11 @@
 #define _priq_wait_add		z_priq_simple_add
 #define _priq_wait_remove	z_priq_simple_remove
 #define _priq_wait_best		z_priq_simple_best
+/* Multi Queue Wait Queue */
+#elif defined(CONFIG_WAITQ_MULTIQ)
+#define _priq_wait_add		z_priq_mq_wait_add
+#define _priq_wait_remove	z_priq_mq_wait_remove
+#define _priq_wait_best		z_priq_mq_wait_best
 #endif
 
 #if defined(CONFIG_64BIT)
@@ -348,6 +353,87 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 
 	return NULL;
 }
+
+#ifdef CONFIG_WAITQ_MULTIQ
+/* Wait queues are usually statically initialized to zero, so unlike the
+ * run queue their lists are not all valid: a list is only initialized
+ * when a thread is added while its bit is clear, and only lists whose
+ * bit is set may be looked at.
+ */
+static ALWAYS_INLINE bool z_priq_mq_queue_is_used(struct _priq_mq *pq,
+						  unsigned int index)
+{
+	return (pq->bitmask[index / NBITS] & BIT(index % NBITS)) != 0;
+}
+
+static ALWAYS_INLINE void z_priq_mq_wait_add(struct _priq_mq *pq,
+					     struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	if (!z_priq_mq_queue_is_used(pq, pos.offset_prio)) {
+		sys_dlist_init(&pq->queues[pos.offset_prio]);
+		pq->bitmask[pos.idx] |= BIT(pos.bit);
+	}
+
+	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE void z_priq_mq_wait_remove(struct _priq_mq *pq,
+						struct k_thread *thread)
+{
+	struct prio_info pos = get_prio_info(thread->base.prio);
+
+	sys_dlist_dequeue(&thread->base.qnode_dlist);
+	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio])) {
+		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+	}
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_mq_wait_best(struct _priq_mq *pq)
+{
+	unsigned int index = z_priq_mq_best_queue_index(pq);
+	sys_dnode_t *n;
+
+	if (!z_priq_mq_queue_is_used(pq, index)) {
+		return NULL;
+	}
+
+	n = sys_dlist_peek_head_not_empty(&pq->queues[index]);
+
+	return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+}
+
+/* Thread following @a thread in the wait queue, in wakeup order */
+static ALWAYS_INLINE struct k_thread *z_priq_mq_wait_next(struct _priq_mq *pq,
+							  struct k_thread *thread)
+{
+	unsigned int index = get_prio_info(thread->base.prio).offset_prio;
+	sys_dnode_t *n;
+
+	n = sys_dlist_peek_next(&pq->queues[index], &thread->base.qnode_dlist);
+	if (n != NULL) {
+		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	}
+
+	for (unsigned int i = (index + 1) / NBITS; i < PRIQ_BITMAP_SIZE; i++) {
+		unsigned long bits = pq->bitmask[i];
+
+		if (i == (index + 1) / NBITS) {
+			bits &= ~(BIT((index + 1) % NBITS) - 1);
+		}
+
+		if (bits != 0) {
+			index = i * NBITS + TRAILING_ZEROS(bits);
+			n = sys_dlist_peek_head_not_empty(&pq->queues[index]);
+
+			return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_WAITQ_MULTIQ */
 #ifdef IAR_SUPPRESS_ALWAYS_INLINE_WARNING_FLAG
 TOOLCHAIN_ENABLE_WARNING(TOOLCHAIN_WARNING_ALWAYS_INLINE)
 #endif
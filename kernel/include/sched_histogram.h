@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_SCHED_HISTOGRAM_H_
+#define ZEPHYR_KERNEL_INCLUDE_SCHED_HISTOGRAM_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/timer/system_timer.h>
+
+#ifdef CONFIG_SCHED_HISTOGRAM
+
+/* Bits of thread->base.ready_flags */
+#define Z_SCHED_READY_STAMPED  BIT(0)
+#define Z_SCHED_READY_FROM_ISR BIT(1)
+
+/* Called with the scheduler lock held when a thread is added to the run
+ * queue, to measure how long it waits there.
+ */
+static ALWAYS_INLINE void z_sched_hist_ready(struct k_thread *thread)
+{
+	thread->base.ready_stamp = sys_clock_cycle_get_32();
+	thread->base.ready_flags = Z_SCHED_READY_STAMPED |
+				   (arch_is_in_isr() ? Z_SCHED_READY_FROM_ISR : 0U);
+}
+
+/* Called with interrupts locked from z_thread_mark_switched_out() and
+ * z_thread_mark_switched_in() respectively.
+ */
+void z_sched_hist_switched_out(void);
+void z_sched_hist_switched_in(void);
+
+#else
+
+#define z_sched_hist_ready(thread) do { } while (false)
+#define z_sched_hist_switched_out() do { } while (false)
+#define z_sched_hist_switched_in() do { } while (false)
+
+#endif /* CONFIG_SCHED_HISTOGRAM */
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_SCHED_HISTOGRAM_H_ */
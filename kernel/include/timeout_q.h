@@ -28,8 +28,19 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static inline void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack)
+{
+	/* Taken into account the next time the timeout is added */
+	to->slack = (uint32_t)CLAMP(slack.ticks, 0, INT32_MAX);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /* Adds the timeout to the queue.
  *
  * @return Absolute tick value when timeout will expire.
@@ -74,11 +74,16 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
-typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
+typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes,
+				      uintptr_t caller);
 
+/* The caller of the k_heap API is passed down to sys_heap, so that the heap
+ * profiler charges the allocations to it rather than to this file.
+ */
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
 				 k_timeout_t timeout,
-				 sys_heap_allocator_t *sys_heap_allocator)
+				 sys_heap_allocator_t *sys_heap_allocator,
+				 uintptr_t caller)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
@@ -90,7 +95,7 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_allocator(&heap->heap, align, bytes);
+		ret = sys_heap_allocator(&heap->heap, align, bytes, caller);
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -116,18 +121,24 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	return ret;
 }
 
-void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
+static void *z_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout,
+			  uintptr_t caller)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
 	void *ret = z_heap_alloc_helper(heap, 0, bytes, timeout,
-					sys_heap_noalign_alloc);
+					sys_heap_noalign_alloc_caller, caller);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
 
 	return ret;
 }
 
+void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
+{
+	return z_heap_alloc(heap, bytes, timeout, (uintptr_t)__builtin_return_address(0));
+}
+
 void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 			k_timeout_t timeout)
 {
@@ -138,7 +149,8 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		 "align must be a power of 2");
 
 	void *ret = z_heap_alloc_helper(heap, align, bytes, timeout,
-					sys_heap_aligned_alloc);
+					sys_heap_aligned_alloc_caller,
+					(uintptr_t)__builtin_return_address(0));
 
 	/*
 	 * modules/debug/percepio/TraceRecorder/kernelports/Zephyr/include/tracing_tracerecorder.h
@@ -162,7 +174,7 @@ void *k_heap_calloc(struct k_heap *heap, size_t num, size_t size, k_timeout_t ti
 	size_t bounds = 0U;
 
 	if (!size_mul_overflow(num, size, &bounds)) {
-		ret = k_heap_alloc(heap, bounds, timeout);
+		ret = z_heap_alloc(heap, bounds, timeout, (uintptr_t)__builtin_return_address(0));
 	}
 	if (ret != NULL) {
 		(void)memset(ret, 0, bounds);
@@ -185,7 +197,8 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
 	while (ret == NULL) {
-		ret = sys_heap_realloc(&heap->heap, ptr, bytes);
+		ret = sys_heap_realloc_caller(&heap->heap, ptr, bytes,
+					      (uintptr_t)__builtin_return_address(0));
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -18,6 +18,47 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+/* Blocks freed on a CPU are kept in the cache of that CPU, up to
+ * CACHE_DEPTH, and allocated from it first. The blocks of the caches are
+ * counted in slab->info.num_used. A cache lock may be taken while
+ * holding the slab lock but not the other way around, blocks given back
+ * to the slab are unlinked from the cache before its lock is released.
+ */
+#define CACHE_DEPTH CONFIG_MEM_SLAB_PER_CPU_CACHE_DEPTH
+#define CACHE_BATCH MAX(1, CACHE_DEPTH / 2)
+
+static struct z_mem_slab_cache *cache_lock(struct k_mem_slab *slab, k_spinlock_key_t *key)
+{
+	/* The thread may migrate once the CPU is read, that only makes it
+	 * contend with the threads of that CPU on the cache lock.
+	 */
+	struct z_mem_slab_cache *cache = &slab->cache[arch_curr_cpu()->id];
+
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+/* Number of blocks handed out, called with the slab lock held */
+static uint32_t num_used_locked(struct k_mem_slab *slab)
+{
+	uint32_t num_used = slab->info.num_used;
+
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_cache *cache = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		num_used -= cache->count;
+		k_spin_unlock(&cache->lock, key);
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
+	return num_used;
+}
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -33,6 +74,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = num_used_locked(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -45,12 +87,14 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 	struct k_mem_slab *slab;
 	k_spinlock_key_t   key;
 	struct sys_memory_stats *ptr = stats;
+	uint32_t num_used;
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	num_used = num_used_locked(slab);
+	ptr->free_bytes = (slab->info.num_blocks - num_used) *
 			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->allocated_bytes = num_used * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -180,6 +224,13 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	slab->cache_bypass = false;
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		slab->cache[i] = (struct z_mem_slab_cache) {};
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -219,13 +270,178 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	k_spinlock_key_t key;
+	struct z_mem_slab_cache *cache = cache_lock(slab, &key);
+	char *block = cache->free_list;
+
+	if (block != NULL) {
+		cache->free_list = *(char **)block;
+		cache->count--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	*mem = block;
+
+	return block != NULL;
+}
+
+/* Move a batch of blocks to the cache of the current CPU, called with
+ * the slab lock held.
+ */
+static void cache_refill(struct k_mem_slab *slab)
+{
+	k_spinlock_key_t key;
+	struct z_mem_slab_cache *cache = cache_lock(slab, &key);
+
+	while ((cache->count < CACHE_BATCH) && (slab->free_list != NULL)) {
+		char *block = slab->free_list;
+
+		slab->free_list = *(char **)block;
+		*(char **)block = cache->free_list;
+		cache->free_list = block;
+		cache->count++;
+		slab->info.num_used++;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+}
+
+/* Give the blocks of all the caches back to the slab, called with the
+ * slab lock held.
+ */
+static void cache_drain_all(struct k_mem_slab *slab)
+{
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_mem_slab_cache *cache = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+		while (cache->free_list != NULL) {
+			char *block = cache->free_list;
+
+			cache->free_list = *(char **)block;
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+		}
+
+		slab->info.num_used -= cache->count;
+		cache->count = 0U;
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+
+/* Give a list of blocks detached from a cache back to the slab, handing
+ * them over to the pending threads first.
+ */
+static void cache_flush(struct k_mem_slab *slab, char *list)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	while (list != NULL) {
+		char *block = list;
+		struct k_thread *pending_thread = NULL;
+
+		list = *(char **)block;
+
+		if (slab->free_list == NULL) {
+			pending_thread = z_unpend_first_thread(&slab->wait_q);
+		}
+
+		if (pending_thread != NULL) {
+			z_thread_return_value_set_with_data(pending_thread, 0, block);
+			z_ready_thread(pending_thread);
+			resched = true;
+		} else {
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+			slab->info.num_used--;
+		}
+	}
+
+	if (resched) {
+		slab->cache_bypass = z_waitq_head(&slab->wait_q) != NULL;
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	k_spinlock_key_t key;
+	struct z_mem_slab_cache *cache = cache_lock(slab, &key);
+	char *drain = NULL;
+
+	/* Set by the threads about to pend on the slab, which must be
+	 * woken up by the next free. The drain of this cache done before
+	 * pending orders it with this cache lock.
+	 */
+	if (slab->cache_bypass) {
+		k_spin_unlock(&cache->lock, key);
+		return false;
+	}
+
+	*(char **)mem = cache->free_list;
+	cache->free_list = mem;
+	cache->count++;
+
+	if (cache->count > CACHE_DEPTH) {
+		char *last = cache->free_list;
+
+		for (unsigned int i = 1; i < CACHE_BATCH; i++) {
+			last = *(char **)last;
+		}
+
+		drain = cache->free_list;
+		cache->free_list = *(char **)last;
+		cache->count -= CACHE_BATCH;
+		*(char **)last = NULL;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	if (drain != NULL) {
+		cache_flush(slab, drain);
+	}
+
+	return true;
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (slab->free_list == NULL) {
+		/* The free blocks may all sit in the caches. A thread that
+		 * may pend also needs the next freed block to be given back
+		 * to the slab rather than cached, or it would not be woken.
+		 */
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			slab->cache_bypass = true;
+		}
+		cache_drain_all(slab);
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
@@ -241,6 +457,13 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 					  slab->info.max_used);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+		slab->cache_bypass = z_waitq_head(&slab->wait_q) != NULL;
+		if (!slab->cache_bypass) {
+			cache_refill(slab);
+		}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -276,6 +499,15 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -285,6 +517,10 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		if (unlikely(pending_thread != NULL)) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+			slab->cache_bypass = z_waitq_head(&slab->wait_q) != NULL;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 			z_thread_return_value_set_with_data(pending_thread, 0, mem);
 			z_ready_thread(pending_thread);
 			z_reschedule(&slab->lock, key);
@@ -295,6 +531,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 	slab->free_list = (char *) mem;
 	slab->info.num_used--;
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+	/* No thread is pending on the slab anymore */
+	slab->cache_bypass = false;
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
@@ -307,9 +548,10 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	}
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = num_used_locked(slab);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
+	stats->allocated_bytes = num_used * slab->info.block_size;
+	stats->free_bytes = (slab->info.num_blocks - num_used) *
 			    slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
@@ -323,6 +565,18 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 	return 0;
 }
 
+#ifdef CONFIG_MEM_SLAB_PER_CPU_CACHE
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = num_used_locked(slab);
+
+	k_spin_unlock(&slab->lock, key);
+
+	return num_used;
+}
+#endif /* CONFIG_MEM_SLAB_PER_CPU_CACHE */
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 {
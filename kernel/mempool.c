@@ -9,10 +9,14 @@
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
 
-typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
+typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes,
+				      uintptr_t caller);
 
+/* The caller of k_malloc() and friends is passed down to sys_heap, so that
+ * the heap profiler charges the allocations to it rather than to this file.
+ */
 static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
-			    sys_heap_allocator_t sys_heap_allocator)
+			    sys_heap_allocator_t sys_heap_allocator, uintptr_t caller)
 {
 	void *mem;
 	struct k_heap **heap_ref;
@@ -39,7 +43,7 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
 	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
+	mem = sys_heap_allocator(&heap->heap, __align, size, caller);
 	k_spin_unlock(&heap->lock, key);
 
 	if (mem == NULL) {
@@ -81,24 +85,30 @@ void *k_aligned_alloc(size_t align, size_t size)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
-	void *ret = z_alloc_helper(_SYSTEM_HEAP, align, size, sys_heap_aligned_alloc);
+	void *ret = z_alloc_helper(_SYSTEM_HEAP, align, size, sys_heap_aligned_alloc_caller,
+				   (uintptr_t)__builtin_return_address(0));
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
-void *k_malloc(size_t size)
+static void *z_malloc(size_t size, uintptr_t caller)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_malloc, _SYSTEM_HEAP);
 
-	void *ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc);
+	void *ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc_caller, caller);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_malloc, _SYSTEM_HEAP, ret);
 
 	return ret;
 }
 
+void *k_malloc(size_t size)
+{
+	return z_malloc(size, (uintptr_t)__builtin_return_address(0));
+}
+
 void *k_calloc(size_t nmemb, size_t size)
 {
 	void *ret;
@@ -112,7 +122,7 @@ void *k_calloc(size_t nmemb, size_t size)
 		return NULL;
 	}
 
-	ret = k_malloc(bounds);
+	ret = z_malloc(bounds, (uintptr_t)__builtin_return_address(0));
 	if (ret != NULL) {
 		(void)memset(ret, 0, bounds);
 	}
@@ -133,7 +143,7 @@ void *k_realloc(void *ptr, size_t size)
 		return NULL;
 	}
 	if (ptr == NULL) {
-		return k_malloc(size);
+		return z_malloc(size, (uintptr_t)__builtin_return_address(0));
 	}
 	heap_ref = ptr;
 	ptr = --heap_ref;
@@ -151,7 +161,8 @@ void *k_realloc(void *ptr, size_t size)
 	 * Better bypass it and go directly to sys_heap_realloc() instead.
 	 */
 	key = k_spin_lock(&heap->lock);
-	ret = sys_heap_realloc(&heap->heap, ptr, size);
+	ret = sys_heap_realloc_caller(&heap->heap, ptr, size,
+				      (uintptr_t)__builtin_return_address(0));
 	k_spin_unlock(&heap->lock, key);
 
 	if (ret != NULL) {
@@ -173,7 +184,7 @@ void k_thread_system_pool_assign(struct k_thread *thread)
 #endif /* K_HEAP_MEM_POOL_SIZE */
 
 static void *z_thread_alloc_helper(size_t align, size_t size,
-				   sys_heap_allocator_t sys_heap_allocator)
+				   sys_heap_allocator_t sys_heap_allocator, uintptr_t caller)
 {
 	void *ret;
 	struct k_heap *heap;
@@ -185,7 +196,7 @@ static void *z_thread_alloc_helper(size_t align, size_t size,
 	}
 
 	if (heap != NULL) {
-		ret = z_alloc_helper(heap, align, size, sys_heap_allocator);
+		ret = z_alloc_helper(heap, align, size, sys_heap_allocator, caller);
 	} else {
 		ret = NULL;
 	}
@@ -195,10 +206,12 @@ static void *z_thread_alloc_helper(size_t align, size_t size,
 
 void *z_thread_aligned_alloc(size_t align, size_t size)
 {
-	return z_thread_alloc_helper(align, size, sys_heap_aligned_alloc);
+	return z_thread_alloc_helper(align, size, sys_heap_aligned_alloc_caller,
+				     (uintptr_t)__builtin_return_address(0));
 }
 
 void *z_thread_malloc(size_t size)
 {
-	return z_thread_alloc_helper(0, size, sys_heap_noalign_alloc);
+	return z_thread_alloc_helper(0, size, sys_heap_noalign_alloc_caller,
+				     (uintptr_t)__builtin_return_address(0));
 }
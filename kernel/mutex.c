@@ -102,6 +102,66 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+/* Must be called with the lock held, on a free mutex or one owned by the
+ * current thread.
+ */
+static inline void mutex_acquire(struct k_mutex *mutex)
+{
+	mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
+				_current->base.prio :
+				mutex->owner_orig_prio;
+
+	mutex->lock_count++;
+	mutex->owner = _current;
+
+	LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
+		_current, mutex, mutex->lock_count,
+		mutex->owner_orig_prio);
+}
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/*
+ * Spin while the owner of the mutex is running on another CPU, as it is
+ * likely to release the mutex soon, instead of paying for two context
+ * switches. The owner does not need to inherit our priority while it is
+ * running, that is done only if we end up pending.
+ *
+ * Must be called with the lock held, which is released while spinning.
+ * Returns true if the mutex was found free, with the lock held.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	uint32_t start = k_cycle_get_32();
+	struct k_thread *owner = mutex->owner;
+
+	while (z_is_thread_running(owner)) {
+		k_spin_unlock(&lock, *key);
+
+		do {
+			arch_nop();
+			compiler_barrier();
+		} while ((mutex->owner == owner) && z_is_thread_running(owner) &&
+			 ((k_cycle_get_32() - start) < limit));
+
+		*key = k_spin_lock(&lock);
+
+		if (mutex->lock_count == 0U) {
+			return true;
+		}
+
+		if ((k_cycle_get_32() - start) >= limit) {
+			break;
+		}
+
+		/* The mutex may have been handed over to another thread */
+		owner = mutex->owner;
+	}
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -116,16 +176,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
-		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
-					_current->base.prio :
-					mutex->owner_orig_prio;
-
-		mutex->lock_count++;
-		mutex->owner = _current;
-
-		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
-			_current, mutex, mutex->lock_count,
-			mutex->owner_orig_prio);
+		mutex_acquire(mutex);
 
 		k_spin_unlock(&lock, key);
 
@@ -144,6 +195,18 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (mutex_spin(mutex, &key)) {
+		mutex_acquire(mutex);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	new_prio = new_prio_for_inheritance(_current->base.prio,
 					    mutex->owner->base.prio);
 
@@ -144,6 +144,9 @@ static inline void register_event(struct k_poll_event *event,
 	case K_POLL_TYPE_DATA_AVAILABLE:
 		__ASSERT(event->queue != NULL, "invalid queue\n");
 		add_event(&event->queue->poll_events, event, poller);
+#ifdef CONFIG_QUEUE_LOCKLESS
+		atomic_inc(&event->queue->waiters);
+#endif /* CONFIG_QUEUE_LOCKLESS */
 		break;
 	case K_POLL_TYPE_SIGNAL:
 		__ASSERT(event->signal != NULL, "invalid poll signal\n");
@@ -183,6 +186,12 @@ static inline void clear_event_registration(struct k_poll_event *event)
 	case K_POLL_TYPE_DATA_AVAILABLE:
 		__ASSERT(event->queue != NULL, "invalid queue\n");
 		remove_event = true;
+#ifdef CONFIG_QUEUE_LOCKLESS
+		/* Signaled events were already unregistered by the queue */
+		if (sys_dnode_is_linked(&event->_node)) {
+			atomic_dec(&event->queue->waiters);
+		}
+#endif /* CONFIG_QUEUE_LOCKLESS */
 		break;
 	case K_POLL_TYPE_SIGNAL:
 		__ASSERT(event->signal != NULL, "invalid poll signal\n");
@@ -244,6 +253,16 @@ static inline int register_events(struct k_poll_event *events,
 		} else if (!just_check && poller->is_polling) {
 			register_event(&events[ii], poller);
 			events_registered += 1;
+
+			/* Data may have been appended to a queue without its lock
+			 * before the registration was visible, check again.
+			 */
+			if (IS_ENABLED(CONFIG_QUEUE_LOCKLESS) &&
+			    (events[ii].type == K_POLL_TYPE_DATA_AVAILABLE) &&
+			    is_condition_met(&events[ii], &state)) {
+				set_event_ready(&events[ii], state);
+				poller->is_polling = false;
+			}
 		} else {
 			/* Event is not one of those identified in is_condition_met()
 			 * catching non-polling events, or is marked for just check,
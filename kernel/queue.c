@@ -60,6 +60,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_LOCKLESS
+	atomic_ptr_clear(&queue->incoming);
+	atomic_clear(&queue->waiters);
+#endif /* CONFIG_QUEUE_LOCKLESS */
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -87,7 +91,16 @@ static void prepare_thread_to_run(struct k_thread *thread, void *data)
 static inline bool handle_poll_events(struct k_queue *queue, uint32_t state)
 {
 #ifdef CONFIG_POLL
-	return z_handle_obj_poll_events(&queue->poll_events, state);
+	bool signaled = z_handle_obj_poll_events(&queue->poll_events, state);
+
+#ifdef CONFIG_QUEUE_LOCKLESS
+	/* The signaled poller is no longer registered on the queue */
+	if (signaled) {
+		atomic_dec(&queue->waiters);
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
+	return signaled;
 #else
 	ARG_UNUSED(queue);
 	ARG_UNUSED(state);
@@ -96,6 +109,128 @@ static inline bool handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+/*
+ * As long as no thread is pending on or polling the queue, k_queue_append()
+ * pushes the items on the incoming atomic list instead of taking the queue
+ * lock. Consumers register themselves in the waiters count before looking
+ * for data a last time and blocking, while producers push their item before
+ * checking the waiters count. Either the producer sees the consumer and takes
+ * the locked path to notify it, or the consumer finds the item.
+ */
+static bool queue_append_lockless(struct k_queue *queue, void *data)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->incoming);
+		*(void **)data = head;
+	} while (!atomic_ptr_cas(&queue->incoming, head, data));
+
+	return atomic_get(&queue->waiters) == 0;
+}
+
+/* Move the items of the incoming list to the tail of the queue. The incoming
+ * list is in LIFO order, reverse it to preserve the order of the appends.
+ * Must be called with the queue lock held.
+ */
+static void queue_incoming_flush(struct k_queue *queue)
+{
+	void *node = atomic_ptr_clear(&queue->incoming);
+	void *tail = node;
+	void *head = NULL;
+
+	if (node == NULL) {
+		return;
+	}
+
+	while (node != NULL) {
+		void *next = *(void **)node;
+
+		*(void **)node = head;
+		head = node;
+		node = next;
+	}
+
+	sys_sflist_append_list(&queue->data_q, head, tail);
+}
+
+/* Hand the queued items to the pending threads, which may be left waiting
+ * while items sit in the queue when the incoming list was flushed before
+ * the producer of these items took the lock. Must be called with the queue
+ * lock held.
+ */
+static bool queue_dispatch(struct k_queue *queue)
+{
+	struct k_thread *thread;
+	bool resched = false;
+
+	if (atomic_get(&queue->waiters) == 0) {
+		return false;
+	}
+
+	while (!sys_sflist_is_empty(&queue->data_q)) {
+		thread = z_unpend_first_thread(&queue->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+
+		prepare_thread_to_run(thread,
+			z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q), true));
+		resched = true;
+	}
+
+	return resched;
+}
+
+/* Slow path of k_queue_append() when a consumer must be notified */
+static void queue_append_notify(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	bool resched;
+
+	queue_incoming_flush(queue);
+	resched = queue_dispatch(queue);
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&queue->lock, key);
+	} else {
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+
+/* Flush the incoming list before accessing the queue without its lock */
+static void queue_incoming_sync(struct k_queue *queue)
+{
+	if (atomic_ptr_get(&queue->incoming) != NULL) {
+		K_SPINLOCK(&queue->lock) {
+			queue_incoming_flush(queue);
+		}
+	}
+}
+#else
+static inline void queue_incoming_flush(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+
+static inline bool queue_dispatch(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+
+	return false;
+}
+
+static inline void queue_incoming_sync(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -139,6 +274,9 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+	queue_incoming_flush(queue);
+	resched = queue_dispatch(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
@@ -171,7 +309,7 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
 
 	sys_sflist_insert(&queue->data_q, prev, data);
-	resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE) || resched;
 
 out:
 	if (resched) {
@@ -198,7 +336,13 @@ void k_queue_append(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, append, queue);
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	if (!queue_append_lockless(queue, data)) {
+		queue_append_notify(queue);
+	}
+#else
 	(void)queue_insert(queue, NULL, data, false, true);
+#endif /* CONFIG_QUEUE_LOCKLESS */
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
 }
@@ -269,6 +413,9 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	queue_incoming_flush(queue);
+	resched = queue_dispatch(queue);
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -339,6 +486,8 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+	queue_incoming_flush(queue);
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -361,18 +510,63 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 		return NULL;
 	}
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	/* Register as a waiter before looking a last time for the items
+	 * appended without the lock, see queue_append_lockless().
+	 */
+	atomic_inc(&queue->waiters);
+	queue_incoming_flush(queue);
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		atomic_dec(&queue->waiters);
+		data = z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q), true);
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
+
+		return data;
+	}
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_LOCKLESS
+	atomic_dec(&queue->waiters);
+#endif /* CONFIG_QUEUE_LOCKLESS */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
 		(ret != 0) ? NULL : _current->base.swap_data);
 
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+size_t k_queue_get_bulk(struct k_queue *queue, void **data, size_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	size_t n = 0;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get_bulk, queue, count);
+
+	queue_incoming_flush(queue);
+
+	while ((n < count) && !sys_sflist_is_empty(&queue->data_q)) {
+		data[n] = z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q), true);
+		n++;
+	}
+
+	k_spin_unlock(&queue->lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_bulk, queue, count, n);
+
+	return n;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	queue_incoming_sync(queue);
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -386,6 +580,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 	sys_sfnode_t *test;
 
+	queue_incoming_sync(queue);
+
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
@@ -403,6 +599,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	queue_incoming_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -412,6 +610,8 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	queue_incoming_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
@@ -9,6 +9,7 @@
 #include <wait_q.h>
 #include <kthread.h>
 #include <priority_q.h>
+#include <sched_histogram.h>
 #include <kswap.h>
 #include <ipi.h>
 #include <kernel_arch_func.h>
@@ -114,6 +115,7 @@ static inline bool should_queue_thread(struct k_thread *thread)
 static ALWAYS_INLINE void queue_thread(struct k_thread *thread)
 {
 	z_mark_thread_as_queued(thread);
+	z_sched_hist_ready(thread);
 	if (should_queue_thread(thread)) {
 		runq_add(thread);
 	}
@@ -345,7 +347,12 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
-static void ready_thread(struct k_thread *thread)
+/* Add a thread to the run queue, accumulating the CPUs needing an IPI in
+ * @a ipi_mask. The caller is responsible for updating the cache and for
+ * flagging the IPIs, which lets a batch of threads be readied with a single
+ * cache update and a single set of IPIs.
+ */
+static bool ready_thread_deferred(struct k_thread *thread, atomic_val_t *ipi_mask)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(sys_cache_is_mem_coherent(thread));
@@ -358,9 +365,21 @@ static void ready_thread(struct k_thread *thread)
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
 		queue_thread(thread);
-		update_cache(0);
+		*ipi_mask |= ipi_mask_create(thread);
 
-		flag_ipi(ipi_mask_create(thread));
+		return true;
+	}
+
+	return false;
+}
+
+static void ready_thread(struct k_thread *thread)
+{
+	atomic_val_t ipi_mask = 0;
+
+	if (ready_thread_deferred(thread, &ipi_mask)) {
+		update_cache(0);
+		flag_ipi(ipi_mask);
 	}
 }
 
@@ -622,33 +641,70 @@ void z_unpend_thread_no_timeout(struct k_thread *thread)
 	}
 }
 
+static bool wake_thread_locked(struct k_thread *thread, bool is_timeout,
+			       atomic_val_t *ipi_mask)
+{
+	bool killed = (thread->base.thread_state &
+			(_THREAD_DEAD | _THREAD_ABORTING));
+
+#ifdef CONFIG_EVENTS
+	bool do_nothing = thread->no_wake_on_timeout && is_timeout;
+
+	thread->no_wake_on_timeout = false;
+
+	if (do_nothing) {
+		return false;
+	}
+#else
+	ARG_UNUSED(is_timeout);
+#endif /* CONFIG_EVENTS */
+
+	if (killed) {
+		return false;
+	}
+
+	/* The thread is not being killed */
+	if (thread->base.pended_on != NULL) {
+		unpend_thread_no_timeout(thread);
+	}
+	z_mark_thread_as_not_sleeping(thread);
+
+	return ready_thread_deferred(thread, ipi_mask);
+}
+
 void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 {
+	atomic_val_t ipi_mask = 0;
+
 	K_SPINLOCK(&_sched_spinlock) {
-		bool killed = (thread->base.thread_state &
-				(_THREAD_DEAD | _THREAD_ABORTING));
+		if (wake_thread_locked(thread, is_timeout, &ipi_mask)) {
+			update_cache(0);
+			flag_ipi(ipi_mask);
+		}
+	}
+}
 
 #ifdef CONFIG_EVENTS
-		bool do_nothing = thread->no_wake_on_timeout && is_timeout;
+void z_sched_wake_thread_list(struct k_thread *head)
+{
+	atomic_val_t ipi_mask = 0;
+	bool readied = false;
 
-		thread->no_wake_on_timeout = false;
+	K_SPINLOCK(&_sched_spinlock) {
+		struct k_thread *next;
 
-		if (do_nothing) {
-			continue;
+		for (struct k_thread *thread = head; thread != NULL; thread = next) {
+			next = thread->next_event_link;
+			readied |= wake_thread_locked(thread, false, &ipi_mask);
 		}
-#endif /* CONFIG_EVENTS */
 
-		if (!killed) {
-			/* The thread is not being killed */
-			if (thread->base.pended_on != NULL) {
-				unpend_thread_no_timeout(thread);
-			}
-			z_mark_thread_as_not_sleeping(thread);
-			ready_thread(thread);
+		if (readied) {
+			update_cache(0);
+			flag_ipi(ipi_mask);
 		}
 	}
-
 }
+#endif /* CONFIG_EVENTS */
 
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 /* Timeout handler for *_thread_timeout() APIs */
@@ -986,18 +1042,47 @@ void *z_get_next_switch_handle(void *interrupted)
 }
 #endif /* CONFIG_USE_SWITCH */
 
-int z_unpend_all(_wait_q_t *wait_q)
+/* Unpend and ready all the threads of a wait queue at once. The cache is
+ * updated and the IPIs are flagged only once for the whole batch, instead
+ * of once per thread. Must be called with _sched_spinlock held.
+ */
+static int unpend_all_locked(_wait_q_t *wait_q, bool set_retval,
+			     int swap_retval, void *swap_data)
 {
-	int need_sched = 0;
+	atomic_val_t ipi_mask = 0;
+	bool readied = false;
 	struct k_thread *thread;
+	int woken = 0;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	for (thread = _priq_wait_best(&wait_q->waitq); thread != NULL;
+	     thread = _priq_wait_best(&wait_q->waitq)) {
+		if (set_retval) {
+			z_thread_return_value_set_with_data(thread, swap_retval,
+							    swap_data);
+		}
+		unpend_thread_no_timeout(thread);
+		z_abort_thread_timeout(thread);
+		readied |= ready_thread_deferred(thread, &ipi_mask);
+		woken++;
 	}
 
-	return need_sched;
+	if (readied) {
+		update_cache(0);
+		flag_ipi(ipi_mask);
+	}
+
+	return woken;
+}
+
+int z_unpend_all(_wait_q_t *wait_q)
+{
+	int woken = 0;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		woken = unpend_all_locked(wait_q, false, 0, NULL);
+	}
+
+	return (woken > 0) ? 1 : 0;
 }
 
 void init_ready_q(struct _ready_q *ready_q)
@@ -1285,14 +1370,7 @@ static inline k_tid_t z_vrfy_k_sched_current_thread_query(void)
 
 static inline void unpend_all(_wait_q_t *wait_q)
 {
-	struct k_thread *thread;
-
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		unpend_thread_no_timeout(thread);
-		z_abort_thread_timeout(thread);
-		arch_thread_return_value_set(thread, 0);
-		ready_thread(thread);
-	}
+	(void)unpend_all_locked(wait_q, true, 0, NULL);
 }
 
 #ifdef CONFIG_THREAD_ABORT_HOOK
@@ -1548,6 +1626,17 @@ bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 	return ret;
 }
 
+int z_sched_wake_all(_wait_q_t *wait_q, int swap_retval, void *swap_data)
+{
+	int woken = 0;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		woken = unpend_all_locked(wait_q, true, swap_retval, swap_data);
+	}
+
+	return woken;
+}
+
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
 {
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/math_extras.h>
+#include <kthread.h>
+#include <sched_histogram.h>
+#include <string.h>
+
+/* The histograms of a CPU are only updated by that CPU with interrupts
+ * locked, so that they need no other locking.  Readers copy them without
+ * synchronization and may see a sample partially recorded.
+ */
+static struct k_sched_histograms histograms[CONFIG_MP_MAX_NUM_CPUS];
+
+static struct sched_hist_stamps {
+	uint32_t switch_out;
+	uint32_t lock;
+	bool switching;
+} stamps[CONFIG_MP_MAX_NUM_CPUS];
+
+static ALWAYS_INLINE void hist_record(struct k_sched_histogram *hist, uint32_t cycles)
+{
+	unsigned int bucket = 0U;
+
+	if (cycles != 0U) {
+		bucket = MIN(32U - u32_count_leading_zeros(cycles),
+			     K_SCHED_HISTOGRAM_BUCKETS - 1U);
+	}
+
+	hist->buckets[bucket]++;
+	hist->count++;
+	hist->total += cycles;
+	hist->max = MAX(hist->max, cycles);
+}
+
+void z_sched_hist_switched_out(void)
+{
+	unsigned int id = _current_cpu->id;
+	struct k_thread *thread = _current;
+	uint32_t now = sys_clock_cycle_get_32();
+
+	stamps[id].switch_out = now;
+	stamps[id].switching = true;
+
+	/* A preempted thread is still in the run queue, and waits there from
+	 * now on.  Dummy threads are not initialized enough to be tracked.
+	 */
+	if ((thread != NULL) && !is_thread_dummy(thread) && z_is_thread_queued(thread) &&
+	    ((thread->base.ready_flags & Z_SCHED_READY_STAMPED) == 0U)) {
+		thread->base.ready_stamp = now;
+		thread->base.ready_flags = Z_SCHED_READY_STAMPED;
+	}
+}
+
+void z_sched_hist_switched_in(void)
+{
+	unsigned int id = _current_cpu->id;
+	struct k_sched_histograms *hist = &histograms[id];
+	struct k_thread *thread = _current;
+	uint32_t now = sys_clock_cycle_get_32();
+
+	if (stamps[id].switching) {
+		hist_record(&hist->switch_latency, now - stamps[id].switch_out);
+		stamps[id].switching = false;
+	}
+
+	if ((thread->base.ready_flags & Z_SCHED_READY_STAMPED) != 0U) {
+		uint32_t wait = now - thread->base.ready_stamp;
+
+		hist_record(&hist->runq_wait, wait);
+		if ((thread->base.ready_flags & Z_SCHED_READY_FROM_ISR) != 0U) {
+			hist_record(&hist->isr_wake, wait);
+		}
+
+		thread->base.ready_flags = 0U;
+	}
+}
+
+void z_sched_hist_lock_acquired(void)
+{
+	stamps[_current_cpu->id].lock = sys_clock_cycle_get_32();
+}
+
+void z_sched_hist_lock_released(void)
+{
+	unsigned int id = _current_cpu->id;
+
+	hist_record(&histograms[id].lock_hold, sys_clock_cycle_get_32() - stamps[id].lock);
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS_SCHED
+static struct k_obj_type obj_type_sched;
+static struct k_obj_core obj_core_sched;
+
+static int sched_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	ARG_UNUSED(obj_core);
+
+	memcpy(stats, histograms, sizeof(histograms));
+
+	return 0;
+}
+
+static void hist_add(struct k_sched_histogram *sum, const struct k_sched_histogram *hist)
+{
+	for (unsigned int i = 0; i < K_SCHED_HISTOGRAM_BUCKETS; i++) {
+		sum->buckets[i] += hist->buckets[i];
+	}
+
+	sum->count += hist->count;
+	sum->total += hist->total;
+	sum->max = MAX(sum->max, hist->max);
+}
+
+static int sched_stats_query(struct k_obj_core *obj_core, void *stats)
+{
+	struct k_sched_histograms *sum = stats;
+
+	ARG_UNUSED(obj_core);
+
+	memset(sum, 0, sizeof(*sum));
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		hist_add(&sum->runq_wait, &histograms[i].runq_wait);
+		hist_add(&sum->switch_latency, &histograms[i].switch_latency);
+		hist_add(&sum->isr_wake, &histograms[i].isr_wake);
+		hist_add(&sum->lock_hold, &histograms[i].lock_hold);
+	}
+
+	return 0;
+}
+
+static int sched_stats_reset(struct k_obj_core *obj_core)
+{
+	ARG_UNUSED(obj_core);
+
+	memset(histograms, 0, sizeof(histograms));
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sched_stats_desc = {
+	.raw_size = sizeof(histograms),
+	.query_size = sizeof(struct k_sched_histograms),
+	.raw   = sched_stats_raw,
+	.query = sched_stats_query,
+	.reset = sched_stats_reset,
+	.disable = NULL,
+	.enable  = NULL,
+};
+
+static int init_sched_obj_core(void)
+{
+	z_obj_type_init(&obj_type_sched, K_OBJ_TYPE_SCHED_ID, 0);
+	k_obj_type_stats_init(&obj_type_sched, &sched_stats_desc);
+
+	k_obj_core_init_and_link(&obj_core_sched, &obj_type_sched);
+	k_obj_core_stats_register(&obj_core_sched, histograms, sizeof(histograms));
+
+	return 0;
+}
+
+SYS_INIT(init_sched_obj_core, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_STATS_SCHED */
@@ -14,8 +14,16 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 
+#ifdef CONFIG_SYSTEM_WORKQUEUE_POOL
+static K_THREAD_STACK_ARRAY_DEFINE(sys_work_q_stacks,
+				   CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+
+static struct k_work_q_worker sys_work_q_workers[CONFIG_SYSTEM_WORKQUEUE_POOL_SIZE];
+#else
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+#endif /* CONFIG_SYSTEM_WORKQUEUE_POOL */
 
 struct k_work_q k_sys_work_q;
 
@@ -26,12 +34,22 @@ static int k_sys_work_q_init(void)
 		.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
 		.essential = true,
 		.work_timeout_ms = CONFIG_SYSTEM_WORKQUEUE_WORK_TIMEOUT_MS,
+		.pin_workers = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_POOL_PIN),
 	};
 
+#ifdef CONFIG_SYSTEM_WORKQUEUE_POOL
+	k_work_queue_pool_start(&k_sys_work_q,
+				sys_work_q_workers,
+				ARRAY_SIZE(sys_work_q_workers),
+				sys_work_q_stacks[0],
+				CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE,
+				CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+#else
 	k_work_queue_start(&k_sys_work_q,
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+#endif /* CONFIG_SYSTEM_WORKQUEUE_POOL */
 	return 0;
 }
 
@@ -21,6 +21,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <kernel_internal.h>
 #include <kswap.h>
+#include <sched_histogram.h>
 #include <zephyr/init.h>
 #include <zephyr/tracing/tracing.h>
 #include <string.h>
@@ -135,6 +136,25 @@ static inline int z_vrfy_k_thread_priority_get(k_tid_t thread)
 #include <zephyr/syscalls/k_thread_priority_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_thread_timeout_slack_set(k_tid_t thread, k_timeout_t slack)
+{
+	z_timeout_slack_set(&thread->base.timeout, slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_timeout_slack_set(k_tid_t thread, k_timeout_t slack)
+{
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(Z_IS_TIMEOUT_RELATIVE(slack) &&
+				    !K_TIMEOUT_EQ(slack, K_FOREVER),
+				    "invalid slack"));
+	z_impl_k_thread_timeout_slack_set(thread, slack);
+}
+#include <zephyr/syscalls/k_thread_timeout_slack_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int z_impl_k_thread_name_set(k_tid_t thread, const char *str)
 {
 #ifdef CONFIG_THREAD_NAME
@@ -903,6 +923,10 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 	thread_base->slice_expired = NULL;
 #endif /* CONFIG_TIMESLICE_PER_THREAD */
 
+#ifdef CONFIG_SCHED_HISTOGRAM
+	thread_base->ready_flags = 0U;
+#endif /* CONFIG_SCHED_HISTOGRAM */
+
 	/* swap_data does not need to be initialized */
 
 	z_init_thread_timeout(thread_base);
@@ -1133,6 +1157,8 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif /* CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+	z_sched_hist_switched_in();
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif /* CONFIG_TRACING */
@@ -1144,6 +1170,8 @@ void z_thread_mark_switched_out(void)
 	z_sched_usage_stop();
 #endif /*CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+	z_sched_hist_switched_out();
+
 #ifdef CONFIG_TRACING
 #ifdef CONFIG_THREAD_LOCAL_STORAGE
 	/* Dummy thread won't have TLS set up to run arbitrary code */
@@ -11,11 +11,43 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/llext/symbol.h>
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/*
+ * Hierarchical timing wheel.  Every level has WHEEL_SLOTS slots and each
+ * slot of level N spans WHEEL_SLOTS^N ticks.  A timeout stores its absolute
+ * expiry in dticks and sits at the level of the most significant digit in
+ * which that expiry differs from wheel_now, so it only has to be moved
+ * ("cascaded") one or more levels down once the wheel reaches the start of
+ * its slot.  Timeouts beyond the range of the top level are parked on an
+ * overflow list that is redistributed each time the top level wraps.
+ *
+ * wheel_now only advances on wheel events (expiries and cascades) and thus
+ * may lag curr_tick, which just makes the placement of new timeouts a bit
+ * coarser.
+ */
+#define WHEEL_BITS      5
+#define WHEEL_SLOTS     BIT(WHEEL_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS    CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_BITS * WHEEL_LEVELS)
+
+/* Value of wheel_next when the earliest expiry has to be looked up again */
+#define WHEEL_NEXT_UNKNOWN 0ULL
+
+/* Slot lists are (re)initialized when their bit in wheel_map gets set */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t wheel_map[WHEEL_LEVELS];
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+static uint64_t wheel_now;
+static uint64_t wheel_next = UINT64_MAX;
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -26,6 +58,10 @@ static struct k_spinlock timeout_lock;
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static struct sys_clock_timeout_stats timeout_stats;
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 
@@ -38,6 +74,211 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Wheel level holding an expiry, WHEEL_LEVELS meaning the overflow list */
+static unsigned int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = (expiry ^ wheel_now) >> WHEEL_BITS;
+	unsigned int level = 0U;
+
+	while ((diff != 0U) && (level < WHEEL_LEVELS)) {
+		diff >>= WHEEL_BITS;
+		level++;
+	}
+
+	return level;
+}
+
+static unsigned int wheel_slot(uint64_t expiry, unsigned int level)
+{
+	return (expiry >> (level * WHEEL_BITS)) & WHEEL_SLOT_MASK;
+}
+
+static void wheel_insert(struct _timeout *t)
+{
+	uint64_t expiry = t->dticks;
+	unsigned int level = wheel_level(expiry);
+	unsigned int slot;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &t->node);
+		return;
+	}
+
+	slot = wheel_slot(expiry, level);
+	if ((wheel_map[level] & BIT(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		wheel_map[level] |= BIT(slot);
+	}
+	sys_dlist_append(&wheel[level][slot], &t->node);
+}
+
+static void wheel_remove(struct _timeout *t)
+{
+	uint64_t expiry = t->dticks;
+	unsigned int level = wheel_level(expiry);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS) {
+		unsigned int slot = wheel_slot(expiry, level);
+
+		if (sys_dlist_is_empty(&wheel[level][slot])) {
+			wheel_map[level] &= ~BIT(slot);
+		}
+	}
+
+	if (expiry == wheel_next) {
+		wheel_next = WHEEL_NEXT_UNKNOWN;
+	}
+}
+
+/* Tick of the next wheel event: an expiry when *level is zero, otherwise
+ * the start of the slot that has to be cascaded.  UINT64_MAX if empty.
+ */
+static uint64_t wheel_next_event(unsigned int *level)
+{
+	for (unsigned int l = 0U; l < WHEEL_LEVELS; l++) {
+		if (wheel_map[l] != 0U) {
+			unsigned int shift = l * WHEEL_BITS;
+			uint64_t base = wheel_now & ~(BIT64(shift + WHEEL_BITS) - 1U);
+
+			*level = l;
+			return base | ((uint64_t)(find_lsb_set(wheel_map[l]) - 1U) << shift);
+		}
+	}
+
+	*level = WHEEL_LEVELS;
+	if (sys_dlist_is_empty(&wheel_overflow)) {
+		return UINT64_MAX;
+	}
+
+	return (wheel_now | (BIT64(WHEEL_SPAN_BITS) - 1U)) + 1U;
+}
+
+static sys_dlist_t *wheel_event_list(uint64_t tick, unsigned int level)
+{
+	return (level == WHEEL_LEVELS) ? &wheel_overflow
+				       : &wheel[level][wheel_slot(tick, level)];
+}
+
+/* Redistribute a slot (or the overflow list) once the wheel reaches it */
+static void wheel_cascade(uint64_t tick, unsigned int level)
+{
+	sys_dlist_t *list = wheel_event_list(tick, level);
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+	while ((node = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	if (level < WHEEL_LEVELS) {
+		wheel_map[level] &= ~BIT(wheel_slot(tick, level));
+	}
+
+	wheel_now = tick;
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+static uint64_t wheel_first_expiry(void)
+{
+	if (wheel_next == WHEEL_NEXT_UNKNOWN) {
+		unsigned int level;
+		uint64_t tick = wheel_next_event(&level);
+
+		/* Expiries in a slot of a higher level are not ordered, but
+		 * they are all later than the start of the slot and earlier
+		 * than anything else on the wheel.
+		 */
+		if ((level != 0U) && (tick != UINT64_MAX)) {
+			sys_dlist_t *list = wheel_event_list(tick, level);
+			struct _timeout *t;
+
+			tick = UINT64_MAX;
+			SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+				tick = min(tick, (uint64_t)t->dticks);
+			}
+		}
+
+		wheel_next = tick;
+	}
+
+	return wheel_next;
+}
+
+static int64_t first_dticks(void)
+{
+	uint64_t expiry = wheel_first_expiry();
+
+	return (expiry == UINT64_MAX) ? -1 : (int64_t)(expiry - curr_tick);
+}
+
+static bool timeout_is_first(const struct _timeout *t)
+{
+	return (uint64_t)t->dticks == wheel_first_expiry();
+}
+
+/* On entry dticks is relative to curr_tick */
+static void timeout_insert(struct _timeout *to)
+{
+	to->dticks += curr_tick;
+	wheel_insert(to);
+
+	if ((wheel_next != WHEEL_NEXT_UNKNOWN) && ((uint64_t)to->dticks < wheel_next)) {
+		wheel_next = to->dticks;
+	}
+}
+
+static void timeout_remove(struct _timeout *t)
+{
+	wheel_remove(t);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+/* Dequeues the first timeout expiring within ticks, setting *dt to its
+ * expiry relative to curr_tick.
+ */
+static struct _timeout *timeout_pop(int32_t ticks, int32_t *dt)
+{
+	uint64_t limit = curr_tick + ticks;
+	unsigned int level;
+	uint64_t tick;
+
+	for (tick = wheel_next_event(&level); tick <= limit;
+	     tick = wheel_next_event(&level)) {
+		if (level == 0U) {
+			struct _timeout *t = CONTAINER_OF(
+				sys_dlist_peek_head(wheel_event_list(tick, level)),
+				struct _timeout, node);
+
+			wheel_now = tick;
+			wheel_remove(t);
+			*dt = tick - curr_tick;
+			t->dticks = 0;
+			return t;
+		}
+
+		wheel_cascade(tick, level);
+	}
+
+	return NULL;
+}
+
+static void timeout_advance(int32_t ticks)
+{
+	/* Expiries are absolute, nothing to adjust */
+	ARG_UNUSED(ticks);
+}
+#else
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -61,6 +302,105 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static int64_t first_dticks(void)
+{
+	struct _timeout *to = first();
+
+	return (to == NULL) ? -1 : to->dticks;
+}
+
+static bool timeout_is_first(const struct _timeout *t)
+{
+	return t == first();
+}
+
+/* On entry dticks is relative to curr_tick */
+static void timeout_insert(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
+static void timeout_remove(struct _timeout *t)
+{
+	remove_timeout(t);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+/* Dequeues the first timeout expiring within ticks, setting *dt to its
+ * expiry relative to curr_tick.
+ */
+static struct _timeout *timeout_pop(int32_t ticks, int32_t *dt)
+{
+	struct _timeout *t = first();
+
+	if ((t == NULL) || (t->dticks > ticks)) {
+		return NULL;
+	}
+
+	*dt = t->dticks;
+	t->dticks = 0;
+	remove_timeout(t);
+
+	return t;
+}
+
+static void timeout_advance(int32_t ticks)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Returns the tick within [expiry, expiry + slack] with the most trailing
+ * zero bits, i.e. the end of the window rounded down on the highest bit in
+ * which it differs from its start.  Timeouts with overlapping windows tend
+ * to be moved to the same tick, where they are all handled by a single
+ * announcement.
+ */
+static uint64_t slack_apply(uint64_t expiry, uint32_t slack)
+{
+	uint64_t limit = expiry + slack;
+	uint64_t diff = expiry ^ limit;
+
+	if (diff == 0U) {
+		return expiry;
+	}
+
+	return limit & ~(BIT64(63U - u64_count_leading_zeros(diff)) - 1U);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -84,14 +424,14 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	int64_t dticks = first_dticks();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks < 0) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = SYS_CLOCK_MAX_WAIT;
 	} else {
-		ret = max(0, to->dticks - ticks_elapsed);
+		ret = max(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
@@ -113,7 +453,6 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
@@ -129,20 +468,22 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
+#ifdef CONFIG_TIMEOUT_SLACK
+		if (to->slack != 0U) {
+			uint64_t expiry = curr_tick + to->dticks;
+			uint64_t delay = slack_apply(expiry, to->slack) - expiry;
+
+			if (delay != 0U) {
+				to->dticks += delay;
+				ticks += delay;
+				timeout_stats.deferred++;
 			}
-			to->dticks -= t->dticks;
 		}
+#endif /* CONFIG_TIMEOUT_SLACK */
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		timeout_insert(to);
 
-		if (to == first() && announce_remaining == 0) {
+		if (timeout_is_first(to) && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -162,9 +503,9 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+			bool is_first = timeout_is_first(to);
 
-			remove_timeout(to);
+			timeout_remove(to);
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
 			if (is_first) {
@@ -176,21 +517,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -249,15 +575,20 @@ void sys_clock_announce(int32_t ticks)
 	announce_remaining = ticks;
 
 	struct _timeout *t;
+	int32_t dt;
+#ifdef CONFIG_TIMEOUT_SLACK
+	unsigned int fired = 0U;
+#endif /* CONFIG_TIMEOUT_SLACK */
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
-
+	while ((t = timeout_pop(announce_remaining, &dt)) != NULL) {
 		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+
+#ifdef CONFIG_TIMEOUT_SLACK
+		timeout_stats.expired++;
+		if (fired++ != 0U) {
+			timeout_stats.coalesced++;
+		}
+#endif /* CONFIG_TIMEOUT_SLACK */
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -265,9 +596,7 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
+	timeout_advance(announce_remaining);
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -281,6 +610,15 @@ void sys_clock_announce(int32_t ticks)
 #endif /* CONFIG_TIMESLICING */
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void sys_clock_timeout_stats_get(struct sys_clock_timeout_stats *stats)
+{
+	K_SPINLOCK(&timeout_lock) {
+		*stats = timeout_stats;
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
@@ -351,9 +689,54 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 }
 
 #ifdef CONFIG_ZTEST
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+/* Move pending timeouts along with the tick count, as the delta list
+ * implicitly does.
+ */
+static void wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+	for (unsigned int level = 0U; level < WHEEL_LEVELS; level++) {
+		for (unsigned int slot = 0U; slot < WHEEL_SLOTS; slot++) {
+			if ((wheel_map[level] & BIT(slot)) == 0U) {
+				continue;
+			}
+
+			while ((node = sys_dlist_get(&wheel[level][slot])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		wheel_map[level] = 0U;
+	}
+
+	while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	wheel_now = tick;
+	wheel_next = WHEEL_NEXT_UNKNOWN;
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks = t->dticks - curr_tick + tick;
+		wheel_insert(t);
+	}
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		wheel_rebase(tick);
+		curr_tick = tick;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
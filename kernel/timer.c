@@ -413,6 +413,25 @@ static inline void z_vrfy_k_timer_user_data_set(struct k_timer *timer,
 
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	z_timeout_slack_set(&timer->timeout, slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer, k_timeout_t slack)
+{
+	K_OOPS(K_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(Z_IS_TIMEOUT_RELATIVE(slack) &&
+				    !K_TIMEOUT_EQ(slack, K_FOREVER),
+				    "invalid slack"));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <zephyr/syscalls/k_timer_slack_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 #ifdef CONFIG_OBJ_CORE_TIMER
 static int init_timer_obj_core_list(void)
 {
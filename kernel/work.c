@@ -176,6 +176,317 @@ int k_work_busy_get(const struct k_work *work)
 	return ret;
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	return queue->workers != NULL;
+}
+
+static inline bool work_is_flusher(const struct k_work *work)
+{
+	return work->handler == handle_flush;
+}
+
+/* Find the worker of a pool run by the current thread.
+ *
+ * @return the worker, or NULL if the current thread is not a worker.
+ */
+static struct k_work_q_worker *pool_worker_current(struct k_work_q *queue)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (&queue->workers[i].thread == _current) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the worker of a pool running a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the worker, or NULL if the work is not running.
+ */
+static struct k_work_q_worker *pool_worker_running(struct k_work_q *queue,
+						   const struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		if (queue->workers[i].current == work) {
+			return &queue->workers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the pending list of a pool holding a queued work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the list, or NULL if the work is not queued to @p queue.
+ */
+static sys_slist_t *pool_pending_find(struct k_work_q *queue,
+				      struct k_work *work)
+{
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		sys_snode_t *prev;
+
+		if (sys_slist_find(&queue->workers[i].pending, &work->node, &prev)) {
+			return &queue->workers[i].pending;
+		}
+	}
+
+	return NULL;
+}
+
+/* Steal the oldest work item that can be taken from a worker.
+ *
+ * While the victim is busy, its flushers and the items submitted again
+ * while running wait for the item it runs and are left to it.  The
+ * flushers queued behind the stolen item move with it to the thief,
+ * whose own list is empty.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the stolen work item, or NULL if none could be taken.
+ */
+static struct k_work *pool_steal_locked(struct k_work_q_worker *victim,
+					struct k_work_q_worker *thief)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&victim->pending, node) {
+		struct k_work *work = CONTAINER_OF(node, struct k_work, node);
+
+		if ((victim->current != NULL)
+		    && (work_is_flusher(work)
+			|| flag_test(&work->flags, K_WORK_RUNNING_BIT))) {
+			prev = node;
+			continue;
+		}
+
+		sys_slist_remove(&victim->pending, prev, node);
+
+		node = (prev != NULL) ? sys_slist_peek_next(prev)
+				      : sys_slist_peek_head(&victim->pending);
+		while ((node != NULL)
+		       && work_is_flusher(CONTAINER_OF(node, struct k_work, node))) {
+			sys_snode_t *next = sys_slist_peek_next(node);
+
+			sys_slist_remove(&victim->pending, prev, node);
+			sys_slist_append(&thief->pending, node);
+			node = next;
+		}
+
+		return work;
+	}
+
+	return NULL;
+}
+
+/* Take the next work item of a pool worker, from its own pending list
+ * or else stolen from the other workers in turn.
+ *
+ * Invoked with work lock held.
+ */
+static struct k_work *pool_take_locked(struct k_work_q *queue,
+				       struct k_work_q_worker *worker)
+{
+	sys_snode_t *node = sys_slist_get(&worker->pending);
+	size_t self = worker - queue->workers;
+
+	if (node != NULL) {
+		return CONTAINER_OF(node, struct k_work, node);
+	}
+
+	for (size_t i = 1; i < queue->num_workers; i++) {
+		struct k_work_q_worker *victim
+			= &queue->workers[(self + i) % queue->num_workers];
+		struct k_work *work = pool_steal_locked(victim, worker);
+
+		if (work != NULL) {
+			return work;
+		}
+	}
+
+	return NULL;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+static inline bool work_has_deadline(const struct k_work *work)
+{
+	return flag_test(&work->flags, K_WORK_DEADLINE_BIT);
+}
+
+/* Check whether a work item must run before another one.
+ *
+ * Items with a deadline run before the ones without, which keep their
+ * submission order.
+ */
+static inline bool work_deadline_before(const struct k_work *a,
+					const struct k_work *b)
+{
+	return work_has_deadline(a)
+		&& (!work_has_deadline(b)
+		    || ((int32_t)(b->deadline - a->deadline) > 0));
+}
+
+/* Get the deadline of a work item about to run.
+ *
+ * Invoked with work lock held, as the item may be submitted again with
+ * another deadline while it runs.
+ *
+ * @return true if the item was submitted with a deadline.
+ */
+static inline bool work_deadline_get_locked(const struct k_work *work,
+					    uint32_t *deadline)
+{
+	*deadline = work->deadline;
+
+	/* Flushers only inherit a deadline to keep the lists sorted */
+	return work_has_deadline(work)
+		&& !flag_test(&work->flags, K_WORK_FLUSHING_BIT);
+}
+
+/* Give the work queue thread the deadline of the item it runs. */
+static inline void work_deadline_start(bool timed, uint32_t deadline)
+{
+	if (timed) {
+		k_thread_absolute_deadline_set(_current, (int)deadline);
+	}
+}
+
+/* Account for the completion of an item and give the work queue thread
+ * back the latest deadline.
+ */
+static void work_deadline_stop(struct k_work_q *queue, bool timed,
+			       uint32_t deadline)
+{
+	if (!timed) {
+		return;
+	}
+
+	if ((int32_t)(k_cycle_get_32() - deadline) > 0) {
+		atomic_inc(&queue->deadline_missed);
+	}
+	atomic_inc(&queue->deadline_completed);
+
+	k_thread_deadline_set(_current, INT_MAX);
+}
+#else
+static inline bool work_deadline_get_locked(const struct k_work *work,
+					    uint32_t *deadline)
+{
+	ARG_UNUSED(work);
+
+	*deadline = 0U;
+
+	return false;
+}
+
+static inline void work_deadline_start(bool timed, uint32_t deadline)
+{
+	ARG_UNUSED(timed);
+	ARG_UNUSED(deadline);
+}
+
+static inline void work_deadline_stop(struct k_work_q *queue, bool timed,
+				      uint32_t deadline)
+{
+	ARG_UNUSED(queue);
+	ARG_UNUSED(timed);
+	ARG_UNUSED(deadline);
+}
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
+
+/* Add a work item to a pending list.
+ *
+ * Items submitted with a deadline are inserted in earliest deadline first
+ * order, the other ones are appended.
+ *
+ * Invoked with work lock held.
+ */
+static void pending_add_locked(sys_slist_t *pending, struct k_work *work)
+{
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+	if (work_has_deadline(work)) {
+		sys_snode_t *prev = NULL;
+		sys_snode_t *node;
+
+		SYS_SLIST_FOR_EACH_NODE(pending, node) {
+			if (work_deadline_before(work, CONTAINER_OF(node, struct k_work, node))) {
+				break;
+			}
+			prev = node;
+		}
+
+		sys_slist_insert(pending, prev, &work->node);
+		return;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
+
+	sys_slist_append(pending, &work->node);
+}
+
+/* Get the pending list a work item submitted to a queue goes to.
+ *
+ * For a pool, an item submitted while running goes to the worker
+ * running it so that it is not run again before it completes.  Chained
+ * submissions stay on the submitting worker, the other ones go to the
+ * worker of the current CPU.
+ *
+ * Invoked with work lock held.
+ */
+static sys_slist_t *queue_pending_get(struct k_work_q *queue,
+				      struct k_work *work)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		struct k_work_q_worker *worker = NULL;
+
+		if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			worker = pool_worker_running(queue, work);
+		} else if (!k_is_in_isr()) {
+			worker = pool_worker_current(queue);
+		}
+
+		if (worker == NULL) {
+			worker = &queue->workers[_current_cpu->id % queue->num_workers];
+		}
+
+		return &worker->pending;
+	}
+#else
+	ARG_UNUSED(work);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return &queue->pending;
+}
+
+/* Check whether no work item is queued to a queue.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_is_empty_locked(struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		for (size_t i = 0; i < queue->num_workers; i++) {
+			if (!sys_slist_is_empty(&queue->workers[i].pending)) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return sys_slist_is_empty(&queue->pending);
+}
+
 /* Add a flusher work item to the queue.
  *
  * Invoked with work lock held.
@@ -191,14 +502,38 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct k_work *work,
 				 struct z_work_flusher *flusher)
 {
+	sys_slist_t *pending = &queue->pending;
+	bool queued = (flags_get(&work->flags) & K_WORK_QUEUED) != 0U;
+
 	init_flusher(flusher);
 
-	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
-		sys_slist_insert(&queue->pending, &work->node,
-				 &flusher->work.node);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The flusher goes to the worker holding or running the work */
+	if (queue_is_pool(queue)) {
+		pending = queued ? pool_pending_find(queue, work)
+				 : &pool_worker_running(queue, work)->pending;
+		__ASSERT_NO_MSG(pending != NULL);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	if (queued) {
+		sys_slist_insert(pending, &work->node, &flusher->work.node);
 	} else {
-		sys_slist_prepend(&queue->pending, &flusher->work.node);
+		sys_slist_prepend(pending, &flusher->work.node);
 	}
+
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+	/* Keep the list sorted, the flusher takes the deadline of the
+	 * item it precedes.
+	 */
+	sys_snode_t *next = sys_slist_peek_next(&flusher->work.node);
+
+	if ((next != NULL)
+	    && work_has_deadline(CONTAINER_OF(next, struct k_work, node))) {
+		flusher->work.deadline = CONTAINER_OF(next, struct k_work, node)->deadline;
+		flag_set(&flusher->work.flags, K_WORK_DEADLINE_BIT);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
 }
 
 /* Try to remove a work item from the given queue.
@@ -212,6 +547,17 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+#if defined(CONFIG_WORKQUEUE_POOL)
+		if (queue_is_pool(queue)) {
+			sys_slist_t *pending = pool_pending_find(queue, work);
+
+			if (pending != NULL) {
+				(void)sys_slist_find_and_remove(pending, &work->node);
+			}
+			return;
+		}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 	}
 }
@@ -265,7 +611,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = k_work_queue_thread_is_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -283,7 +629,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		pending_add_locked(queue_pending_get(queue, work), work);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -383,6 +729,13 @@ int z_work_submit_to_queue(struct k_work_q *queue,
 
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+	/* Only submissions with a deadline give one */
+	if (!flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+		flag_clear(&work->flags, K_WORK_DEADLINE_BIT);
+	}
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
+
 	int ret = submit_to_queue_locked(work, &queue);
 
 	k_spin_unlock(&lock, key);
@@ -422,6 +775,51 @@ int k_work_submit(struct k_work *work)
 	return ret;
 }
 
+#if defined(CONFIG_WORKQUEUE_DEADLINE)
+int k_work_submit_with_deadline(struct k_work_q *queue, struct k_work *work,
+				int deadline)
+{
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* A queued item keeps its place in the sorted pending list */
+	if (!flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+		work->deadline = k_cycle_get_32() + CLAMP(deadline, 0, INT_MAX);
+		flag_set(&work->flags, K_WORK_DEADLINE_BIT);
+	}
+
+	int ret = submit_to_queue_locked(work, &queue);
+
+	k_spin_unlock(&lock, key);
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+
+void k_work_queue_deadline_stats_get(struct k_work_q *queue,
+				     struct k_work_queue_deadline_stats *stats)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG(stats != NULL);
+
+	stats->completed = atomic_get(&queue->deadline_completed);
+	stats->missed = atomic_get(&queue->deadline_missed);
+}
+
+void k_work_queue_deadline_stats_reset(struct k_work_q *queue)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+
+	atomic_clear(&queue->deadline_completed);
+	atomic_clear(&queue->deadline_missed);
+}
+#endif /* defined(CONFIG_WORKQUEUE_DEADLINE) */
+
 /* Flush the work item if necessary.
  *
  * Flushing is necessary only if the work is either queued or running.
@@ -648,6 +1046,24 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+/* Mark a work item as no longer running and deal with any cancellation
+ * and flushing issued while it was running.
+ *
+ * Invoked with work lock held.
+ *
+ * Invoked from a work queue thread.
+ */
+static void finalize_work_locked(struct k_work *work)
+{
+	flag_clear(&work->flags, K_WORK_RUNNING_BIT);
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		finalize_flush_locked(work);
+	}
+	if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
+		finalize_cancel_locked(work);
+	}
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -664,6 +1080,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		struct k_work *work = NULL;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
+		uint32_t deadline;
+		bool timed;
 		bool yield;
 
 		/* Check for and prepare any new work. */
@@ -727,6 +1145,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			continue;
 		}
 
+		timed = work_deadline_get_locked(work, &deadline);
+
 #if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
 		work_timeout_start_locked(queue, work);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
@@ -734,7 +1154,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		k_spin_unlock(&lock, key);
 
 		__ASSERT_NO_MSG(handler != NULL);
+		work_deadline_start(timed, deadline);
 		handler(work);
+		work_deadline_stop(queue, timed, deadline);
 
 		/* Mark the work item as no longer running and deal
 		 * with any cancellation and flushing issued while it
@@ -747,13 +1169,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		work_timeout_stop_locked(queue);
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
-		flag_clear(&work->flags, K_WORK_RUNNING_BIT);
-		if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
-			finalize_flush_locked(work);
-		}
-		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
-			finalize_cancel_locked(work);
-		}
+		finalize_work_locked(work);
 
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
@@ -768,6 +1184,96 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	}
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+/* Loop executed by the worker threads of a work queue pool.
+ *
+ * @param worker_ptr pointer to the worker structure
+ */
+static void work_queue_pool_main(void *worker_ptr, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	struct k_work_q_worker *worker = (struct k_work_q_worker *)worker_ptr;
+	struct k_work_q *queue = worker->queue;
+
+	while (true) {
+		struct k_work *work;
+		k_work_handler_t handler;
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		uint32_t deadline;
+		bool timed;
+		bool yield;
+
+		work = pool_take_locked(queue, worker);
+		if (work == NULL) {
+			/* What an idle worker can't steal waits for a busy
+			 * one, so the pool is empty once none is busy.
+			 */
+			bool idle = (queue->num_busy == 0U);
+
+			if (idle && flag_test_and_clear(&queue->flags,
+							K_WORK_QUEUE_DRAIN_BIT)) {
+				(void)z_sched_wake_all(&queue->drainq, 1, NULL);
+			} else if (idle && (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)
+					    || (queue->num_exited != 0U))) {
+				/* Once a worker exited the other ones follow,
+				 * the last one clears the status flags.
+				 */
+				if (++queue->num_exited == queue->num_workers) {
+					flags_set(&queue->flags, 0);
+				}
+				(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+				k_spin_unlock(&lock, key);
+				return;
+			} else {
+				/* Nothing to do, sleep until notified */
+				;
+			}
+
+			(void)z_sched_wait(&lock, key, &queue->notifyq,
+					   K_FOREVER, NULL);
+			continue;
+		}
+
+		queue->num_busy++;
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		flag_set(&work->flags, K_WORK_RUNNING_BIT);
+		flag_clear(&work->flags, K_WORK_QUEUED_BIT);
+		worker->current = work;
+		handler = work->handler;
+		timed = work_deadline_get_locked(work, &deadline);
+
+		/* Let an idle worker steal what is left */
+		if (!sys_slist_is_empty(&worker->pending)) {
+			(void)notify_queue_locked(queue);
+		}
+
+		k_spin_unlock(&lock, key);
+
+		__ASSERT_NO_MSG(handler != NULL);
+		work_deadline_start(timed, deadline);
+		handler(work);
+		work_deadline_stop(queue, timed, deadline);
+
+		key = k_spin_lock(&lock);
+
+		worker->current = NULL;
+		finalize_work_locked(work);
+
+		if (--queue->num_busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
+		k_spin_unlock(&lock, key);
+
+		if (yield) {
+			k_yield();
+		}
+	}
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 void k_work_queue_init(struct k_work_q *queue)
 {
 	__ASSERT_NO_MSG(queue != NULL);
@@ -801,6 +1307,10 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	}
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -823,6 +1333,10 @@ void k_work_queue_start(struct k_work_q *queue,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->workers = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -863,6 +1377,111 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     struct k_work_q_worker *workers, size_t num_workers,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(workers);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_workers > 0U) && (num_workers <= UINT8_MAX));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+	queue->workers = workers;
+	queue->num_workers = num_workers;
+	queue->num_busy = 0U;
+	queue->num_exited = 0U;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+#if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
+	/* The duration of the work items is not monitored in pools */
+	queue->work_timeout = K_FOREVER;
+#endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+	for (size_t i = 0; i < num_workers; i++) {
+		struct k_work_q_worker *worker = &workers[i];
+
+		worker->queue = queue;
+		worker->current = NULL;
+		sys_slist_init(&worker->pending);
+
+		(void)k_thread_create(&worker->thread, &stacks[stride * i],
+				      stack_size, work_queue_pool_main, worker,
+				      NULL, NULL, prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(&worker->thread, cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			worker->thread.base.user_options |= K_ESSENTIAL;
+		}
+
+#if defined(CONFIG_SCHED_CPU_MASK)
+		if ((cfg != NULL) && cfg->pin_workers) {
+			(void)k_thread_cpu_pin(&worker->thread,
+					       i % arch_num_cpus());
+		}
+#endif /* defined(CONFIG_SCHED_CPU_MASK) */
+	}
+
+	/* As for a single thread, work can be submitted before the
+	 * workers get control.
+	 */
+	flags_set(&queue->flags, flags);
+	queue->thread_id = &workers[0].thread;
+
+	for (size_t i = 0; i < num_workers; i++) {
+		k_thread_start(&workers[i].thread);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+
+/* Wait for all the workers of a stopped pool to exit. */
+static int pool_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	for (size_t i = 0; i < queue->num_workers; i++) {
+		int ret = k_thread_join(&queue->workers[i].thread,
+					sys_timepoint_timeout(end));
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+bool k_work_queue_thread_is_current(struct k_work_q *queue)
+{
+	__ASSERT_NO_MSG(queue);
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The workers of a started pool do not change, no lock is needed. */
+	if (queue_is_pool(queue)) {
+		return pool_worker_current(queue) != NULL;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return _current == queue->thread_id;
+}
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -877,7 +1496,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || !queue_is_empty_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -921,7 +1540,16 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, stop, queue, timeout);
 
-	if (z_is_thread_essential(&queue->thread)) {
+	struct k_thread *thread = &queue->thread;
+	int ret;
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue_is_pool(queue)) {
+		thread = &queue->workers[0].thread;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	if (z_is_thread_essential(thread)) {
 		return -ENOTSUP;
 	}
 
@@ -943,7 +1571,15 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	notify_queue_locked(queue);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	ret = queue_is_pool(queue) ? pool_join(queue, timeout)
+				   : k_thread_join(queue->thread_id, timeout);
+#else
+	ret = k_thread_join(queue->thread_id, timeout);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	if (ret != 0) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
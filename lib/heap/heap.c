@@ -160,6 +160,117 @@ static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
 	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
 }
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+static uint32_t slab_full_mask(unsigned int cls)
+{
+	return GENMASK(slab_nslots(cls) - 1U, 0);
+}
+
+static void slab_run_unlink(struct z_heap *h, chunkid_t rc)
+{
+	struct z_heap_slab_run *run = slab_run(h, rc);
+	chunkid_t *head = &h->slab_runs[run->cls];
+
+	if (run->next == rc) {
+		/* this is the last run */
+		*head = 0;
+	} else {
+		slab_run(h, run->prev)->next = run->next;
+		slab_run(h, run->next)->prev = run->prev;
+		if (*head == rc) {
+			*head = run->next;
+		}
+	}
+}
+
+static void slab_run_free(struct z_heap *h, chunkid_t rc)
+{
+	slab_run_unlink(h, rc);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, rc));
+#endif
+
+	set_chunk_used(h, rc, false);
+	free_chunk(h, rc);
+}
+
+/* Runs are added at the head of the list so that their free slots are
+ * used first.  An empty run is only kept while it is the single run of
+ * its class, drop it once another run has free slots.
+ */
+static void slab_run_link(struct z_heap *h, chunkid_t rc)
+{
+	struct z_heap_slab_run *run = slab_run(h, rc);
+	chunkid_t *head = &h->slab_runs[run->cls];
+
+	if (*head != 0U &&
+	    slab_run(h, *head)->free_slots == slab_full_mask(run->cls)) {
+		slab_run_free(h, *head);
+	}
+
+	if (*head == 0U) {
+		run->next = rc;
+		run->prev = rc;
+	} else {
+		struct z_heap_slab_run *second = slab_run(h, *head);
+		struct z_heap_slab_run *first = slab_run(h, second->prev);
+
+		run->next = *head;
+		run->prev = second->prev;
+		first->next = rc;
+		second->prev = rc;
+	}
+
+	*head = rc;
+}
+
+/* Give the empty runs back to the heap, returns true if there was any */
+static bool slab_reclaim(struct z_heap *h)
+{
+	bool reclaimed = false;
+
+	for (unsigned int cls = 0; cls < SLAB_CLASSES; cls++) {
+		chunkid_t rc = h->slab_runs[cls];
+
+		if (rc != 0U && slab_run(h, rc)->free_slots == slab_full_mask(cls)) {
+			slab_run_free(h, rc);
+			reclaimed = true;
+		}
+	}
+
+	return reclaimed;
+}
+
+static void slab_free(struct sys_heap *heap, chunkid_t c, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	chunkid_t rc = left_chunk(h, c);
+	struct z_heap_slab_run *run = slab_run(h, rc);
+	size_t stride = slab_stride(run->cls);
+	unsigned int slot = ((uint8_t *)mem - ((uint8_t *)run + run->first)) / stride;
+
+	__ASSERT(chunk_used(h, c) && (run->free_slots & BIT(slot)) == 0U,
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+
+	set_chunk_used(h, c, false);
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem, stride - CHUNK_UNIT);
+#endif
+
+	if (run->free_slots == 0U) {
+		run->free_slots = BIT(slot);
+		slab_run_link(h, rc);
+	} else {
+		run->free_slots |= BIT(slot);
+		if (run->free_slots == slab_full_mask(run->cls) && run->next != rc) {
+			slab_run_free(h, rc);
+		}
+	}
+}
+#endif
+
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
@@ -168,6 +279,17 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	struct z_heap *h = heap->heap;
 	chunkid_t c = mem_to_chunkid(h, mem);
 
+#ifdef CONFIG_SYS_HEAP_PROFILER
+	heap_profiler_free(mem);
+#endif
+
+#ifdef CONFIG_SYS_HEAP_SLAB
+	if (slab_slot(h, c)) {
+		slab_free(heap, c, mem);
+		return;
+	}
+#endif
+
 	/*
 	 * This should catch many double-free cases.
 	 * This is cheap enough so let's do it all the time.
@@ -205,10 +327,16 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	size_t chunk_base = (size_t)&chunk_buf(h)[c];
 	size_t chunk_sz = chunk_size(h, c) * CHUNK_UNIT;
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+	if (slab_slot(h, c)) {
+		return slab_stride(slab_run(h, left_chunk(h, c))->cls) - CHUNK_UNIT;
+	}
+#endif
+
 	return chunk_sz - (addr - chunk_base);
 }
 
-static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+static chunkid_t bucket_alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
 	struct z_heap_bucket *b = &h->buckets[bi];
@@ -260,7 +388,102 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
-void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = bucket_alloc_chunk(h, sz);
+
+#ifdef CONFIG_SYS_HEAP_SLAB
+	/* The empty runs kept for the slab classes must not make a
+	 * regular allocation fail.
+	 */
+	if (c == 0U && slab_reclaim(h)) {
+		c = bucket_alloc_chunk(h, sz);
+	}
+#endif
+
+	return c;
+}
+
+#ifdef CONFIG_SYS_HEAP_SLAB
+static chunkid_t slab_run_alloc(struct z_heap *h, unsigned int cls)
+{
+	unsigned int nslots = slab_nslots(cls);
+	size_t stride = slab_stride(cls);
+	chunksz_t sz = bytes_to_chunksz(h, sizeof(struct z_heap_slab_run) +
+					   SLAB_ALIGN - 1U + nslots * stride, 0);
+	chunkid_t rc = alloc_chunk(h, sz);
+
+	if (rc == 0U) {
+		return 0;
+	}
+
+	if (chunk_size(h, rc) > sz) {
+		split_chunks(h, rc, rc + sz);
+		free_list_add(h, rc + sz);
+	}
+
+	set_chunk_used(h, rc, true);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	increase_allocated_bytes(h, chunksz_to_bytes(h, chunk_size(h, rc)));
+#endif
+
+	struct z_heap_slab_run *run = slab_run(h, rc);
+	uint8_t *first = (uint8_t *)ROUND_UP((uint8_t *)run + sizeof(*run) + CHUNK_UNIT,
+					     SLAB_ALIGN);
+
+	run->cls = cls;
+	run->first = first - (uint8_t *)run;
+	run->free_slots = slab_full_mask(cls);
+
+	/* Fake chunk headers right below each slot */
+	for (unsigned int i = 0; i < nslots; i++) {
+		chunkid_t c = mem_to_chunkid(h, first + i * stride);
+
+		set_chunk_size(h, c, 0);
+		set_left_chunk_size(h, c, c - rc);
+	}
+
+	slab_run_link(h, rc);
+
+	return rc;
+}
+
+static void *slab_alloc(struct sys_heap *heap, size_t bytes)
+{
+	struct z_heap *h = heap->heap;
+	unsigned int cls = (bytes + CHUNK_UNIT - 1U) / SLAB_ALIGN;
+	chunkid_t rc = h->slab_runs[cls];
+
+	if (rc == 0U) {
+		rc = slab_run_alloc(h, cls);
+		if (rc == 0U) {
+			return NULL;
+		}
+	}
+
+	struct z_heap_slab_run *run = slab_run(h, rc);
+	unsigned int slot = __builtin_ctz(run->free_slots);
+	uint8_t *mem = (uint8_t *)run + run->first + slot * slab_stride(cls);
+
+	run->free_slots &= ~BIT(slot);
+	if (run->free_slots == 0U) {
+		slab_run_unlink(h, rc);
+	}
+
+	set_chunk_used(h, mem_to_chunkid(h, mem), true);
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+				   slab_stride(cls) - CHUNK_UNIT);
+#endif
+
+	IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+	return mem;
+}
+#endif
+
+static void *heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	void *mem;
@@ -269,6 +492,15 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+	if (bytes <= CONFIG_SYS_HEAP_SLAB_MAX_SIZE) {
+		mem = slab_alloc(heap, bytes);
+		if (mem != NULL) {
+			return mem;
+		}
+	}
+#endif
+
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes, 0);
 	chunkid_t c = alloc_chunk(h, chunk_sz);
 
@@ -299,14 +531,35 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	return mem;
 }
 
-void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+void *sys_heap_noalign_alloc_caller(struct sys_heap *heap, size_t align, size_t bytes,
+				    uintptr_t caller)
 {
+	void *mem;
+
 	ARG_UNUSED(align);
 
-	return sys_heap_alloc(heap, bytes);
+	mem = heap_alloc(heap, bytes);
+
+#ifdef CONFIG_SYS_HEAP_PROFILER
+	heap_profiler_alloc(mem, bytes, caller);
+#else
+	ARG_UNUSED(caller);
+#endif
+
+	return mem;
 }
 
-void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
+{
+	return sys_heap_noalign_alloc_caller(heap, 0, bytes, (uintptr_t)__builtin_return_address(0));
+}
+
+void *sys_heap_noalign_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	return sys_heap_noalign_alloc_caller(heap, align, bytes, (uintptr_t)__builtin_return_address(0));
+}
+
+static void *heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 	size_t gap, rew;
@@ -324,8 +577,18 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 		gap = min(rew, chunk_header_bytes(h));
 	} else {
 		if (align <= chunk_header_bytes(h)) {
-			return sys_heap_alloc(heap, bytes);
+			return heap_alloc(heap, bytes);
+		}
+#ifdef CONFIG_SYS_HEAP_SLAB
+		if (align <= SLAB_ALIGN && bytes != 0 &&
+		    bytes <= CONFIG_SYS_HEAP_SLAB_MAX_SIZE) {
+			void *mem = slab_alloc(heap, bytes);
+
+			if (mem != NULL) {
+				return mem;
+			}
 		}
+#endif
 		rew = 0;
 		gap = chunk_header_bytes(h);
 	}
@@ -384,11 +647,38 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	return mem;
 }
 
+void *sys_heap_aligned_alloc_caller(struct sys_heap *heap, size_t align, size_t bytes,
+				    uintptr_t caller)
+{
+	void *mem = heap_aligned_alloc(heap, align, bytes);
+
+#ifdef CONFIG_SYS_HEAP_PROFILER
+	heap_profiler_alloc(mem, bytes, caller);
+#else
+	ARG_UNUSED(caller);
+#endif
+
+	return mem;
+}
+
+void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	return sys_heap_aligned_alloc_caller(heap, align, bytes, (uintptr_t)__builtin_return_address(0));
+}
+
 static bool inplace_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
 
 	chunkid_t c = mem_to_chunkid(h, ptr);
+
+#ifdef CONFIG_SYS_HEAP_SLAB
+	if (slab_slot(h, c)) {
+		/* Slots have a fixed size */
+		return bytes <= sys_heap_usable_size(heap, ptr);
+	}
+#endif
+
 	size_t align_gap = (uint8_t *)ptr - (uint8_t *)chunk_mem(h, c);
 
 	chunksz_t chunks_need = bytes_to_chunksz(h, bytes, align_gap);
@@ -461,11 +751,11 @@ static bool inplace_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 	return false;
 }
 
-void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
+static void *heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 {
 	/* special realloc semantics */
 	if (ptr == NULL) {
-		return sys_heap_alloc(heap, bytes);
+		return heap_alloc(heap, bytes);
 	}
 	if (bytes == 0) {
 		sys_heap_free(heap, ptr);
@@ -477,7 +767,7 @@ void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 	}
 
 	/* In-place realloc was not possible: fallback to allocate and copy. */
-	void *ptr2 = sys_heap_alloc(heap, bytes);
+	void *ptr2 = heap_alloc(heap, bytes);
 
 	if (ptr2 != NULL) {
 		size_t prev_size = sys_heap_usable_size(heap, ptr);
@@ -488,12 +778,30 @@ void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 	return ptr2;
 }
 
-void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
-			       size_t align, size_t bytes)
+void *sys_heap_realloc_caller(struct sys_heap *heap, void *ptr, size_t bytes, uintptr_t caller)
+{
+	void *mem = heap_realloc(heap, ptr, bytes);
+
+#ifdef CONFIG_SYS_HEAP_PROFILER
+	heap_profiler_realloc(ptr, mem, bytes, caller);
+#else
+	ARG_UNUSED(caller);
+#endif
+
+	return mem;
+}
+
+void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
+{
+	return sys_heap_realloc_caller(heap, ptr, bytes, (uintptr_t)__builtin_return_address(0));
+}
+
+static void *heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+				  size_t align, size_t bytes)
 {
 	/* special realloc semantics */
 	if (ptr == NULL) {
-		return sys_heap_aligned_alloc(heap, align, bytes);
+		return heap_aligned_alloc(heap, align, bytes);
 	}
 	if (bytes == 0) {
 		sys_heap_free(heap, ptr);
@@ -511,7 +819,7 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	 * Either ptr is not sufficiently aligned for in-place realloc or
 	 * in-place realloc was not possible: fallback to allocate and copy.
 	 */
-	void *ptr2 = sys_heap_aligned_alloc(heap, align, bytes);
+	void *ptr2 = heap_aligned_alloc(heap, align, bytes);
 
 	if (ptr2 != NULL) {
 		size_t prev_size = sys_heap_usable_size(heap, ptr);
@@ -522,6 +830,18 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	return ptr2;
 }
 
+void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
+			       size_t align, size_t bytes)
+{
+	void *mem = heap_aligned_realloc(heap, ptr, align, bytes);
+
+#ifdef CONFIG_SYS_HEAP_PROFILER
+	heap_profiler_realloc(ptr, mem, bytes, (uintptr_t)__builtin_return_address(0));
+#endif
+
+	return mem;
+}
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
@@ -571,6 +891,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+	for (unsigned int i = 0; i < SLAB_CLASSES; i++) {
+		h->slab_runs[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -65,6 +65,30 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+/* Small allocations can be served from slab runs.  A run is a regular
+ * used chunk whose memory starts with a struct z_heap_slab_run and is
+ * followed by slots of the same size, the stride, which is a multiple
+ * of SLAB_ALIGN.  The slot memory is aligned to SLAB_ALIGN and each
+ * slot is preceded by a fake chunk header: its SIZE_AND_USED field
+ * holds a zero size, which no real chunk but the end marker has, and
+ * the "used" bit of the slot, and its LEFT_SIZE field holds the
+ * distance to the run chunk.  The runs with at least one free slot
+ * are kept on a circular list per size class.
+ */
+#define SLAB_ALIGN	16U
+#define SLAB_CLASSES	((CONFIG_SYS_HEAP_SLAB_MAX_SIZE + CHUNK_UNIT - 1U) / SLAB_ALIGN + 1U)
+#define SLAB_MAX_SLOTS	32U
+
+struct z_heap_slab_run {
+	chunkid_t next;
+	chunkid_t prev;
+	uint32_t free_slots;
+	uint16_t cls;
+	uint16_t first;
+};
+#endif
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +97,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SLAB
+	chunkid_t slab_runs[SLAB_CLASSES];
 #endif
 	struct z_heap_bucket buckets[];
 };
@@ -264,6 +291,28 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+static inline size_t slab_stride(unsigned int cls)
+{
+	return (cls + 1U) * SLAB_ALIGN;
+}
+
+static inline unsigned int slab_nslots(unsigned int cls)
+{
+	return CLAMP(CONFIG_SYS_HEAP_SLAB_RUN_SIZE / slab_stride(cls), 1U, SLAB_MAX_SLOTS);
+}
+
+static inline bool slab_slot(struct z_heap *h, chunkid_t c)
+{
+	return chunk_size(h, c) == 0U;
+}
+
+static inline struct z_heap_slab_run *slab_run(struct z_heap *h, chunkid_t rc)
+{
+	return (struct z_heap_slab_run *)((uint8_t *)&chunk_buf(h)[rc] + chunk_header_bytes(h));
+}
+#endif
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -281,4 +330,14 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_PROFILER
+/* Profiler hooks, called with the return address into the caller of the
+ * public heap API. The allocation hooks ignore failed allocations, the
+ * realloc hook is given the old and the new pointer.
+ */
+void heap_profiler_alloc(void *mem, size_t bytes, uintptr_t caller);
+void heap_profiler_realloc(void *ptr, void *mem, size_t bytes, uintptr_t caller);
+void heap_profiler_free(void *mem);
+#endif
+
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
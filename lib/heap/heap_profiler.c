@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/heap_profiler.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+#include "heap.h"
+
+#define PERIOD    CONFIG_SYS_HEAP_PROFILER_PERIOD
+#define NUM_SITES CONFIG_SYS_HEAP_PROFILER_SITES
+#define NUM_LIVE  CONFIG_SYS_HEAP_PROFILER_LIVE
+#define DEPTH     CONFIG_SYS_HEAP_PROFILER_DEPTH
+
+/* Longest line of the profile: counts and one address per frame */
+#define LINE_SIZE (96 + DEPTH * (3 + 2 * sizeof(uintptr_t)))
+
+/* Sampled block still allocated. They are kept in an open addressing
+ * table keyed by their address, so that each free only probes a few
+ * entries to find out whether the block was sampled.
+ */
+struct live_block {
+	void *mem;
+	size_t bytes;
+	uint16_t site;
+};
+
+struct backtrace {
+	uintptr_t pcs[DEPTH];
+	uint8_t depth;
+	bool found;
+};
+
+static struct k_spinlock lock;
+static struct sys_heap_profiler_site sites[NUM_SITES];
+static struct live_block live[NUM_LIVE];
+static uint32_t dropped;
+
+/* Read without the lock by the allocation and free hooks */
+static atomic_t num_allocs;
+static atomic_t num_live;
+
+BUILD_ASSERT(NUM_SITES <= UINT16_MAX, "too many heap profiler sites");
+
+#ifdef CONFIG_ARCH_STACKWALK
+static bool backtrace_frame(void *cookie, unsigned long addr)
+{
+	struct backtrace *bt = cookie;
+
+	/* Skip the frames of the profiler and of the heap, up to the
+	 * caller of the heap API.
+	 */
+	if (!bt->found) {
+		bt->found = (addr == bt->pcs[0]);
+		return true;
+	}
+
+	if (bt->depth == DEPTH) {
+		return false;
+	}
+
+	bt->pcs[bt->depth++] = addr;
+
+	return true;
+}
+#endif /* CONFIG_ARCH_STACKWALK */
+
+static void backtrace_get(struct backtrace *bt, uintptr_t caller)
+{
+	bt->pcs[0] = caller;
+	bt->depth = 1;
+
+#ifdef CONFIG_ARCH_STACKWALK
+	/* Only the thread stacks are walked, interrupts and early boot
+	 * allocations get the caller alone.
+	 */
+	if (!k_is_in_isr() && !k_is_pre_kernel()) {
+		bt->found = false;
+		arch_stack_walk(backtrace_frame, bt, k_current_get(), NULL);
+	}
+#endif /* CONFIG_ARCH_STACKWALK */
+}
+
+/* Site of a backtrace, allocated if needed, called with the lock held */
+static int site_get(const struct backtrace *bt)
+{
+	int unused = -1;
+
+	for (unsigned int i = 0; i < NUM_SITES; i++) {
+		struct sys_heap_profiler_site *site = &sites[i];
+
+		if (site->depth == 0U) {
+			if (unused < 0) {
+				unused = i;
+			}
+		} else if ((site->depth == bt->depth) &&
+			   (memcmp(site->pcs, bt->pcs, bt->depth * sizeof(bt->pcs[0])) == 0)) {
+			return i;
+		}
+	}
+
+	if (unused >= 0) {
+		sites[unused] = (struct sys_heap_profiler_site) {};
+		memcpy(sites[unused].pcs, bt->pcs, bt->depth * sizeof(bt->pcs[0]));
+		sites[unused].depth = bt->depth;
+	}
+
+	return unused;
+}
+
+static unsigned int live_hash(const void *mem)
+{
+	return (uint32_t)(((uintptr_t)mem >> 3) * 2654435761U) % NUM_LIVE;
+}
+
+/* Remove an entry of the live table, moving back the following entries
+ * of the probe sequence so that no lookup stops early on the hole.
+ */
+static void live_remove(unsigned int hole)
+{
+	unsigned int i = hole;
+
+	for (;;) {
+		unsigned int home;
+
+		live[hole].mem = NULL;
+
+		do {
+			i = (i + 1U) % NUM_LIVE;
+			if (live[i].mem == NULL) {
+				return;
+			}
+
+			home = live_hash(live[i].mem);
+		} while ((hole <= i) ? ((hole < home) && (home <= i))
+				     : ((hole < home) || (home <= i)));
+
+		live[hole] = live[i];
+		hole = i;
+	}
+}
+
+void heap_profiler_alloc(void *mem, size_t bytes, uintptr_t caller)
+{
+	struct backtrace bt;
+	k_spinlock_key_t key;
+	unsigned int i;
+	int s;
+
+	if ((mem == NULL) || (((uint32_t)atomic_inc(&num_allocs) % PERIOD) != 0U)) {
+		return;
+	}
+
+	/* Walk the stack before taking the lock */
+	backtrace_get(&bt, caller);
+
+	key = k_spin_lock(&lock);
+
+	/* Keep at least one unused entry to end the probe sequences */
+	s = (atomic_get(&num_live) < (NUM_LIVE - 1)) ? site_get(&bt) : -1;
+	if (s < 0) {
+		dropped++;
+		goto out;
+	}
+
+	for (i = live_hash(mem); live[i].mem != NULL; i = (i + 1U) % NUM_LIVE) {
+	}
+
+	live[i].mem = mem;
+	live[i].bytes = bytes;
+	live[i].site = s;
+	atomic_inc(&num_live);
+
+	sites[s].live_count++;
+	sites[s].live_bytes += bytes;
+	sites[s].alloc_count++;
+	sites[s].alloc_bytes += bytes;
+
+out:
+	k_spin_unlock(&lock, key);
+}
+
+void heap_profiler_free(void *mem)
+{
+	k_spinlock_key_t key;
+
+	if (atomic_get(&num_live) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&lock);
+
+	for (unsigned int i = live_hash(mem); live[i].mem != NULL; i = (i + 1U) % NUM_LIVE) {
+		if (live[i].mem == mem) {
+			struct sys_heap_profiler_site *site = &sites[live[i].site];
+
+			site->live_count--;
+			site->live_bytes -= live[i].bytes;
+			live_remove(i);
+			atomic_dec(&num_live);
+			break;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void heap_profiler_realloc(void *ptr, void *mem, size_t bytes, uintptr_t caller)
+{
+	/* A block moved by realloc was freed through sys_heap_free(), one
+	 * resized in place is accounted as freed and allocated again.
+	 */
+	if ((mem != NULL) && (mem == ptr)) {
+		heap_profiler_free(ptr);
+	}
+
+	heap_profiler_alloc(mem, bytes, caller);
+}
+
+int sys_heap_profiler_site_get(unsigned int index, struct sys_heap_profiler_site *site)
+{
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (index >= NUM_SITES) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (sites[index].depth == 0U) {
+		ret = -ENOENT;
+	} else {
+		*site = sites[index];
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+uint32_t sys_heap_profiler_dropped_get(void)
+{
+	return dropped;
+}
+
+void sys_heap_profiler_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (unsigned int i = 0; i < NUM_SITES; i++) {
+		if (sites[i].live_count == 0U) {
+			sites[i].depth = 0U;
+		}
+
+		sites[i].alloc_count = 0U;
+		sites[i].alloc_bytes = 0U;
+	}
+
+	dropped = 0U;
+
+	k_spin_unlock(&lock, key);
+}
+
+void sys_heap_profiler_dump(sys_heap_profiler_line_cb_t cb, void *user_data)
+{
+	struct sys_heap_profiler_site site;
+	uint64_t totals[4] = { 0 };
+	char line[LINE_SIZE];
+	int len;
+
+	/* The sites are read one at a time, the totals of the header may
+	 * not exactly match the sum of the lines if the heaps are in use.
+	 */
+	for (unsigned int i = 0; i < NUM_SITES; i++) {
+		if (sys_heap_profiler_site_get(i, &site) == 0) {
+			totals[0] += site.live_count;
+			totals[1] += site.live_bytes;
+			totals[2] += site.alloc_count;
+			totals[3] += site.alloc_bytes;
+		}
+	}
+
+	/* Legacy pprof heap profile, the "heapprofile" variant has unscaled
+	 * values so the samples are scaled by the period here.
+	 */
+	snprintk(line, sizeof(line), "heap profile: %llu: %llu [%llu: %llu] @ heapprofile",
+		 totals[0] * PERIOD, totals[1] * PERIOD, totals[2] * PERIOD,
+		 totals[3] * PERIOD);
+	cb(line, user_data);
+
+	for (unsigned int i = 0; i < NUM_SITES; i++) {
+		if ((sys_heap_profiler_site_get(i, &site) != 0) ||
+		    ((site.live_count == 0U) && (site.alloc_count == 0U))) {
+			continue;
+		}
+
+		len = snprintk(line, sizeof(line), "%llu: %llu [%llu: %llu] @",
+			       (uint64_t)site.live_count * PERIOD,
+			       (uint64_t)site.live_bytes * PERIOD,
+			       (uint64_t)site.alloc_count * PERIOD,
+			       site.alloc_bytes * PERIOD);
+
+		for (unsigned int j = 0; j < site.depth; j++) {
+			len += snprintk(&line[len], sizeof(line) - len, " 0x%lx",
+					(unsigned long)site.pcs[j]);
+		}
+
+		cb(line, user_data);
+	}
+}
+
+struct dump_buf {
+	char *buf;
+	size_t size;
+	size_t len;
+	bool full;
+};
+
+static void dump_buf_line(const char *line, void *user_data)
+{
+	struct dump_buf *dump = user_data;
+	size_t line_len = strlen(line);
+
+	/* Whole lines only, with room for the newline and the terminator */
+	if (dump->full || (dump->len + line_len + 2U > dump->size)) {
+		dump->full = true;
+		return;
+	}
+
+	memcpy(&dump->buf[dump->len], line, line_len);
+	dump->len += line_len;
+	dump->buf[dump->len++] = '\n';
+	dump->buf[dump->len] = '\0';
+}
+
+size_t sys_heap_profiler_dump_buf(char *buf, size_t size)
+{
+	struct dump_buf dump = {
+		.buf = buf,
+		.size = size,
+	};
+
+	if (size > 0U) {
+		buf[0] = '\0';
+	}
+
+	sys_heap_profiler_dump(dump_buf_line, &dump);
+
+	return dump.len;
+}
@@ -48,6 +48,52 @@ static bool valid_chunk(struct z_heap *h, chunkid_t c)
 	return true;
 }
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+/* Check the runs with free slots of every class, the slot bitmaps and
+ * the fake chunk headers of the slots.  Full runs are not linked
+ * anywhere and only show up as used chunks in the linear walk.
+ */
+static bool valid_slab_runs(struct z_heap *h)
+{
+	for (unsigned int cls = 0; cls < SLAB_CLASSES; cls++) {
+		chunkid_t rc0 = h->slab_runs[cls];
+		uint32_t full = GENMASK(slab_nslots(cls) - 1U, 0);
+		chunkid_t rc = rc0;
+		uint32_t n = 0;
+
+		while (rc != 0 && (n == 0 || rc != rc0)) {
+			struct z_heap_slab_run *run;
+			uint8_t *first;
+
+			VALIDATE(in_bounds(h, rc));
+			VALIDATE(chunk_used(h, rc));
+			VALIDATE(n++ < h->end_chunk);
+
+			run = slab_run(h, rc);
+			VALIDATE(run->cls == cls);
+			VALIDATE(run->free_slots != 0U);
+			VALIDATE((run->free_slots & ~full) == 0U);
+			VALIDATE(slab_run(h, run->next)->prev == rc);
+
+			first = (uint8_t *)run + run->first;
+			for (unsigned int i = 0; i < slab_nslots(cls); i++) {
+				uint8_t *mem = first + i * slab_stride(cls);
+				chunkid_t c = (mem - CHUNK_UNIT - (uint8_t *)chunk_buf(h)) /
+					      CHUNK_UNIT;
+
+				VALIDATE(slab_slot(h, c));
+				VALIDATE(left_chunk(h, c) == rc);
+				VALIDATE(chunk_used(h, c) == ((run->free_slots & BIT(i)) == 0U));
+			}
+
+			rc = run->next;
+		}
+	}
+
+	return true;
+}
+#endif
+
 /* Validate multiple state dimensions for the bucket "next" pointer
  * and see that they match.  Probably should unify the design a
  * bit...
@@ -85,6 +131,12 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SLAB
+	if (!valid_slab_runs(h)) {
+		return false;
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -137,13 +137,246 @@ malloc_unlock(void)
 #define malloc_unlock()
 #endif
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+
+/*
+ * Small blocks are kept on per-CPU free lists, one per size class, so that
+ * most malloc() and free() calls only take the spinlock of the cache of the
+ * current CPU instead of the heap mutex. The lists are refilled from, and
+ * drained to, the heap in batches. Class n holds blocks with at least
+ * (n + 1) * CACHE_GRANULE usable bytes.
+ */
+#define CACHE_GRANULE	MAX(16, __alignof__(z_max_align_t))
+#define CACHE_CLASSES	(CONFIG_COMMON_LIBC_MALLOC_CACHE_MAX_SIZE / CACHE_GRANULE)
+#define CACHE_BATCH	MAX(1, CONFIG_COMMON_LIBC_MALLOC_CACHE_DEPTH / 2)
+
+struct malloc_cache_class {
+	void *head;
+	unsigned int count;
+};
+
+struct malloc_cache {
+	struct k_spinlock lock;
+	struct malloc_cache_class classes[CACHE_CLASSES];
+};
+
+static struct malloc_cache malloc_caches[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Free blocks are linked through their first word */
+static inline void *block_next(void *block)
+{
+	return *(void **)block;
+}
+
+static inline void block_next_set(void *block, void *next)
+{
+	*(void **)block = next;
+}
+
+static struct malloc_cache *cache_lock(k_spinlock_key_t *key)
+{
+	/* The thread may migrate once the CPU is read, that only makes it
+	 * contend with the threads of that CPU on the cache lock.
+	 */
+	struct malloc_cache *cache = &malloc_caches[arch_curr_cpu()->id];
+
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void heap_free_list(void *list)
+{
+	while (list != NULL) {
+		void *next = block_next(list);
+
+		sys_heap_free(&z_malloc_heap, list);
+		list = next;
+	}
+}
+
+/* Give the blocks of every cache back to the heap, with the heap mutex held.
+ * Used when the heap cannot satisfy an allocation.
+ */
+static bool cache_flush(void)
+{
+	bool flushed = false;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct malloc_cache *cache = &malloc_caches[i];
+
+		for (unsigned int c = 0; c < CACHE_CLASSES; c++) {
+			k_spinlock_key_t key = k_spin_lock(&cache->lock);
+			void *list = cache->classes[c].head;
+
+			cache->classes[c].head = NULL;
+			cache->classes[c].count = 0;
+			k_spin_unlock(&cache->lock, key);
+
+			flushed = flushed || (list != NULL);
+			heap_free_list(list);
+		}
+	}
+
+	return flushed;
+}
+
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
+/* Called with the heap mutex held */
+static void *heap_alloc(size_t alignment, size_t size)
+{
+	void *ret = sys_heap_aligned_alloc(&z_malloc_heap, alignment, size);
+
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+	if (ret == NULL && size != 0 && cache_flush()) {
+		ret = sys_heap_aligned_alloc(&z_malloc_heap, alignment, size);
+	}
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
+	return ret;
+}
+
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+
+/* Allocate a block of the class and a batch of more for the cache */
+static void *cache_refill(unsigned int cls)
+{
+	size_t bytes = (cls + 1) * CACHE_GRANULE;
+	struct malloc_cache *cache;
+	k_spinlock_key_t key;
+	void *head = NULL;
+	void *tail = NULL;
+	unsigned int count = 0;
+	void *ret;
+
+	malloc_lock();
+
+	ret = heap_alloc(__alignof__(z_max_align_t), bytes);
+
+	while (ret != NULL && count < CACHE_BATCH) {
+		void *block = sys_heap_aligned_alloc(&z_malloc_heap,
+						     __alignof__(z_max_align_t), bytes);
+
+		if (block == NULL) {
+			break;
+		}
+
+		block_next_set(block, head);
+		head = block;
+		if (tail == NULL) {
+			tail = block;
+		}
+		count++;
+	}
+
+	malloc_unlock();
+
+	if (head != NULL) {
+		cache = cache_lock(&key);
+		block_next_set(tail, cache->classes[cls].head);
+		cache->classes[cls].head = head;
+		cache->classes[cls].count += count;
+		k_spin_unlock(&cache->lock, key);
+	}
+
+	return ret;
+}
+
+static void *cache_alloc(size_t size)
+{
+	unsigned int cls = (size - 1) / CACHE_GRANULE;
+	struct malloc_cache_class *mc;
+	struct malloc_cache *cache;
+	k_spinlock_key_t key;
+	void *ret;
+
+	cache = cache_lock(&key);
+	mc = &cache->classes[cls];
+	ret = mc->head;
+	if (ret != NULL) {
+		mc->head = block_next(ret);
+		mc->count--;
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	if (ret == NULL) {
+		ret = cache_refill(cls);
+	}
+
+	return ret;
+}
+
+/* Returns false if the block is not cacheable and must go back to the heap */
+static bool cache_free(void *ptr)
+{
+	/* The size of an allocated chunk is only changed by freeing or
+	 * reallocating it, so it can be read without the heap mutex.
+	 */
+	size_t usable = sys_heap_usable_size(&z_malloc_heap, ptr);
+	struct malloc_cache_class *mc;
+	struct malloc_cache *cache;
+	k_spinlock_key_t key;
+	void *drain = NULL;
+	unsigned int cls;
+
+	if (usable < CACHE_GRANULE ||
+	    usable >= (CACHE_CLASSES + 1) * CACHE_GRANULE ||
+	    !IS_ALIGNED(ptr, __alignof__(z_max_align_t))) {
+		return false;
+	}
+
+	cls = usable / CACHE_GRANULE - 1;
+
+	cache = cache_lock(&key);
+	mc = &cache->classes[cls];
+	block_next_set(ptr, mc->head);
+	mc->head = ptr;
+	mc->count++;
+
+	if (mc->count > CONFIG_COMMON_LIBC_MALLOC_CACHE_DEPTH) {
+		void *last = mc->head;
+
+		for (unsigned int i = 1; i < CACHE_BATCH; i++) {
+			last = block_next(last);
+		}
+
+		drain = mc->head;
+		mc->head = block_next(last);
+		mc->count -= CACHE_BATCH;
+		block_next_set(last, NULL);
+	}
+	k_spin_unlock(&cache->lock, key);
+
+	if (drain != NULL) {
+		malloc_lock();
+		heap_free_list(drain);
+		malloc_unlock();
+	}
+
+	return true;
+}
+
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
 void *malloc(size_t size)
 {
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+	if (size != 0 && size <= CACHE_CLASSES * CACHE_GRANULE) {
+		void *ret = cache_alloc(size);
+
+		if (ret == NULL) {
+			errno = ENOMEM;
+		}
+
+		return ret;
+	}
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
 	malloc_lock();
 
-	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
-					   __alignof__(z_max_align_t),
-					   size);
+	void *ret = heap_alloc(__alignof__(z_max_align_t), size);
+
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -157,9 +390,7 @@ void *aligned_alloc(size_t alignment, size_t size)
 {
 	malloc_lock();
 
-	void *ret = sys_heap_aligned_alloc(&z_malloc_heap,
-					   alignment,
-					   size);
+	void *ret = heap_alloc(alignment, size);
 	if (ret == NULL && size != 0) {
 		errno = ENOMEM;
 	}
@@ -246,6 +477,14 @@ void *realloc(void *ptr, size_t requested_size)
 					     __alignof__(z_max_align_t),
 					     requested_size);
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+	if (ret == NULL && requested_size != 0 && cache_flush()) {
+		ret = sys_heap_aligned_realloc(&z_malloc_heap, ptr,
+					       __alignof__(z_max_align_t),
+					       requested_size);
+	}
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
 	if (ret == NULL && requested_size != 0) {
 		errno = ENOMEM;
 	}
@@ -257,6 +496,12 @@ void *realloc(void *ptr, size_t requested_size)
 
 void free(void *ptr)
 {
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+	if (ptr != NULL && cache_free(ptr)) {
+		return;
+	}
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
 	malloc_lock();
 	sys_heap_free(&z_malloc_heap, ptr);
 	malloc_unlock();
@@ -241,6 +241,50 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+/* Allocate the data of a buffer taken from its pool and reset it */
+static bool buf_init(struct net_buf *buf, size_t size, k_timeout_t timeout)
+{
+	if (size) {
+		__maybe_unused size_t req_size = size;
+
+		buf->__buf = data_alloc(buf, &size, timeout);
+		if (!buf->__buf) {
+			return false;
+		}
+
+		__ASSERT_NO_MSG(req_size <= size);
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	memset(buf->user_data, 0, buf->user_data_size);
+	net_buf_reset(buf);
+
+	return true;
+}
+
+static void pool_usage_alloc(struct net_buf_pool *pool, size_t count)
+{
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_sub(&pool->avail_count, count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = max(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+}
+
+static void pool_usage_free(struct net_buf_pool *pool, size_t count)
+{
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_add(&pool->avail_count, count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
+#endif
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -327,37 +371,85 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-		__maybe_unused size_t req_size = size;
+	if (!buf_init(buf, size, sys_timepoint_timeout(end))) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		net_buf_destroy(buf);
+		return NULL;
+	}
 
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
+	pool_usage_alloc(pool, 1);
+
+	return buf;
+}
+
+size_t net_buf_alloc_bulk(struct net_buf_pool *pool, size_t size,
+			  struct net_buf **bufs, size_t count,
+			  k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	size_t allocated = 0;
+	size_t i;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(bufs || !count);
+
+	/* Take the free buffers with a single k_queue_get_bulk() call. Like
+	 * in net_buf_alloc_len(), the pool lock is only needed while the pool
+	 * still has uninitialized buffers.
+	 */
+	if (pool->uninit_count) {
+		key = k_spin_lock(&pool->lock);
+
+		if (pool->uninit_count < pool->buf_count) {
+			allocated = k_queue_get_bulk(&pool->free._queue,
+						     (void **)bufs, count);
 		}
 
-		__ASSERT_NO_MSG(req_size <= size);
+		while ((allocated < count) && pool->uninit_count) {
+			bufs[allocated++] = pool_get_uninit(pool,
+							    pool->uninit_count--);
+		}
+
+		k_spin_unlock(&pool->lock, key);
 	} else {
+		allocated = k_queue_get_bulk(&pool->free._queue, (void **)bufs,
+					     count);
+	}
+
+	/* Only wait for the first buffer, the caller can try again for
+	 * the remaining ones.
+	 */
+	if (!allocated && count) {
+		bufs[0] = k_lifo_get(&pool->free, timeout);
+		if (!bufs[0]) {
+			NET_BUF_ERR("Failed to get free buffers");
+			return 0;
+		}
+
+		allocated = 1;
+	}
+
+	for (i = 0; i < allocated; i++) {
+		if (!buf_init(bufs[i], size, sys_timepoint_timeout(end))) {
+			NET_BUF_ERR("Failed to allocate data");
+			break;
+		}
+
+		NET_BUF_DBG("allocated buf %p", bufs[i]);
+	}
+
+	/* Give back the buffers for which no data could be allocated */
+	while (allocated > i) {
+		struct net_buf *buf = bufs[--allocated];
+
 		buf->__buf = NULL;
+		net_buf_destroy(buf);
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	memset(buf->user_data, 0, buf->user_data_size);
-	net_buf_reset(buf);
+	pool_usage_alloc(pool, allocated);
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-	pool->max_used = max(pool->max_used,
-			     pool->buf_count - atomic_get(&pool->avail_count));
-#endif
-	return buf;
+	return allocated;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -466,10 +558,7 @@ void net_buf_unref(struct net_buf *buf)
 
 		pool = net_buf_pool_get(buf->pool_id);
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-		atomic_inc(&pool->avail_count);
-		__ASSERT_NO_MSG(atomic_get(&pool->avail_count) <= pool->buf_count);
-#endif
+		pool_usage_free(pool, 1);
 
 		if (pool->destroy) {
 			pool->destroy(buf);
@@ -481,6 +570,100 @@ void net_buf_unref(struct net_buf *buf)
 	}
 }
 
+/* Buffers released by net_buf_unref_chain_bulk(), not given back yet */
+struct buf_release {
+	struct net_buf_pool *pool;
+	struct net_buf *head;
+	struct net_buf *tail;
+	size_t count;
+};
+
+static void release_flush(struct buf_release *release)
+{
+	if (!release->count) {
+		return;
+	}
+
+	/* The buffers are linked through their first word, as expected by
+	 * the LIFO of the pool.
+	 */
+	*(void **)release->tail = NULL;
+	k_queue_append_list(&release->pool->free._queue, release->head,
+			    release->tail);
+	pool_usage_free(release->pool, release->count);
+
+	release->head = NULL;
+	release->count = 0;
+}
+
+static void release_add(struct buf_release *release, struct net_buf *buf)
+{
+	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+
+	if (pool->destroy) {
+		pool_usage_free(pool, 1);
+		pool->destroy(buf);
+		return;
+	}
+
+	if (buf->__buf) {
+		if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+			pool->alloc->cb->unref(buf, buf->__buf);
+		}
+		buf->__buf = NULL;
+	}
+
+	if (pool != release->pool) {
+		release_flush(release);
+		release->pool = pool;
+	}
+
+	if (release->count) {
+		*(void **)release->tail = buf;
+	} else {
+		release->head = buf;
+	}
+
+	release->tail = buf;
+	release->count++;
+}
+
+void net_buf_unref_chain_bulk(struct net_buf **bufs, size_t count)
+{
+	struct buf_release release = { 0 };
+
+	__ASSERT_NO_MSG(bufs || !count);
+
+	for (size_t i = 0; i < count; i++) {
+		struct net_buf *buf = bufs[i];
+
+		while (buf) {
+			struct net_buf *frags = buf->frags;
+
+			__ASSERT(buf->ref, "buf %p double free", buf);
+			if (!buf->ref) {
+				break;
+			}
+
+			NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf,
+				    buf->ref, buf->pool_id, buf->frags);
+
+			if (--buf->ref > 0) {
+				break;
+			}
+
+			buf->data = NULL;
+			buf->frags = NULL;
+
+			release_add(&release, buf);
+
+			buf = frags;
+		}
+	}
+
+	release_flush(&release);
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
@@ -85,6 +85,9 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 		if (r) {
 			struct k_p4wq_work *w
 				= CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+			/* The handler may submit the item again */
+			int32_t deadline = w->deadline;
+			bool has_deadline = w->has_deadline;
 
 			rb_remove(&queue->queue, r);
 			w->thread = _current;
@@ -98,6 +101,13 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 
 			k = k_spin_lock(&queue->lock);
 
+			if (has_deadline) {
+				queue->completed++;
+				if ((int32_t)(k_cycle_get_32() - (uint32_t)deadline) > 0) {
+					queue->deadline_misses++;
+				}
+			}
+
 			/* Remove from the active list only if it
 			 * wasn't resubmitted already
 			 */
@@ -130,6 +140,27 @@ int k_p4wq_wait(struct k_p4wq_work *work, k_timeout_t timeout)
 	return k_sem_count_get(&work->done_sem) ? 0 : -EBUSY;
 }
 
+void k_p4wq_deadline_stats_get(struct k_p4wq *queue,
+			       struct k_work_queue_deadline_stats *stats)
+{
+	k_spinlock_key_t k = k_spin_lock(&queue->lock);
+
+	stats->completed = queue->completed;
+	stats->missed = queue->deadline_misses;
+
+	k_spin_unlock(&queue->lock, k);
+}
+
+void k_p4wq_deadline_stats_reset(struct k_p4wq *queue)
+{
+	k_spinlock_key_t k = k_spin_lock(&queue->lock);
+
+	queue->completed = 0;
+	queue->deadline_misses = 0;
+
+	k_spin_unlock(&queue->lock, k);
+}
+
 void k_p4wq_init(struct k_p4wq *queue)
 {
 	memset(queue, 0, sizeof(*queue));
@@ -230,8 +261,10 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 
 	/* Input is a delta time from now (to match
 	 * k_thread_deadline_set()), but we store and use the absolute
-	 * cycle count.
+	 * cycle count. Only the items submitted with a deadline are
+	 * counted in the deadline statistics.
 	 */
+	item->has_deadline = (item->deadline != 0);
 	item->deadline += k_cycle_get_32();
 
 	/* Resubmission from within handler?  Remove from active list */
@@ -799,7 +799,7 @@ static struct net_buf *bt_att_chan_create_pdu(struct bt_att_chan *chan, uint8_t
 	default: {
 		k_tid_t current_thread = k_current_get();
 
-		if (current_thread == k_work_queue_thread_get(&k_sys_work_q)) {
+		if (k_work_queue_thread_is_current(&k_sys_work_q)) {
 			/* No blocking in the sysqueue. */
 			timeout = K_NO_WAIT;
 		} else if (current_thread == att_handle_rsp_thread) {
@@ -3972,7 +3972,7 @@ struct bt_att_req *bt_att_req_alloc(k_timeout_t timeout)
 	k_tid_t current_thread = k_current_get();
 
 	if (current_thread == att_handle_rsp_thread ||
-	    current_thread == k_work_queue_thread_get(&k_sys_work_q)) {
+	    k_work_queue_thread_is_current(&k_sys_work_q)) {
 		/* bt_att_req are released by the att_handle_rsp_thread.
 		 * A blocking allocation the same thread would cause a
 		 * deadlock.
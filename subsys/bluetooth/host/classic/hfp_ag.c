@@ -323,7 +323,7 @@ static struct bt_ag_tx *bt_ag_tx_alloc(void)
 	 * so if we're in the same workqueue but there are no immediate
 	 * contexts available, there's no chance we'll get one by waiting.
 	 */
-	if (k_current_get() == &k_sys_work_q.thread) {
+	if (k_work_queue_thread_is_current(&k_sys_work_q)) {
 		return k_fifo_get(&ag_tx_free, K_NO_WAIT);
 	}
 
@@ -53,7 +53,7 @@ int input_report(const struct device *dev,
 	int ret;
 
 	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
-	    k_current_get() == k_work_queue_thread_get(&k_sys_work_q)) {
+	    k_work_queue_thread_is_current(&k_sys_work_q)) {
 		LOG_DBG("Timeout discarded. No blocking in syswq.");
 		timeout = K_NO_WAIT;
 	}
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Internet checksum summing using ARMv8.1-M Helium instructions. The 32-bit
+ * words of each vector are added across into a 64-bit accumulator, which
+ * cannot overflow whatever the packet size.
+ */
+
+#include <arm_mve.h>
+#include <zephyr/kernel.h>
+
+#include "net_private.h"
+
+uint32_t net_chksum_words(const uint32_t *data, size_t count)
+{
+	uint64_t sum = 0;
+
+	for (; count >= 4; count -= 4, data += 4) {
+		sum = vaddlvaq_u32(sum, vld1q_u32(data));
+	}
+
+	for (; count > 0; count--) {
+		sum += *data++;
+	}
+
+	return net_chksum_fold32(sum);
+}
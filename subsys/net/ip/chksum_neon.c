@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Internet checksum summing using ARM64 Advanced SIMD instructions. Pairs of
+ * 32-bit words are added into 64-bit lanes, which cannot overflow whatever
+ * the packet size.
+ */
+
+#include <arm_neon.h>
+#include <zephyr/kernel.h>
+
+#include "net_private.h"
+
+uint32_t net_chksum_words(const uint32_t *data, size_t count)
+{
+	uint64x2_t sum_a = vdupq_n_u64(0);
+	uint64x2_t sum_b = vdupq_n_u64(0);
+	uint64_t sum;
+
+	for (; count >= 8; count -= 8, data += 8) {
+		sum_a = vpadalq_u32(sum_a, vld1q_u32(data));
+		sum_b = vpadalq_u32(sum_b, vld1q_u32(data + 4));
+	}
+
+	sum = vaddvq_u64(vaddq_u64(sum_a, sum_b));
+
+	for (; count > 0; count--) {
+		sum += *data++;
+	}
+
+	return net_chksum_fold32(sum);
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Internet checksum summing using x86-64 SSE2 instructions. The 32-bit words
+ * are widened to 64 bits before being added, so the lanes cannot overflow
+ * whatever the packet size.
+ */
+
+#include <emmintrin.h>
+#include <zephyr/kernel.h>
+
+#include "net_private.h"
+
+uint32_t net_chksum_words(const uint32_t *data, size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i sum_a = zero;
+	__m128i sum_b = zero;
+	uint64_t lanes[2];
+	uint64_t sum;
+
+	for (; count >= 8; count -= 8, data += 8) {
+		__m128i a = _mm_loadu_si128((const __m128i *)data);
+		__m128i b = _mm_loadu_si128((const __m128i *)(data + 4));
+
+		sum_a = _mm_add_epi64(sum_a, _mm_unpacklo_epi32(a, zero));
+		sum_b = _mm_add_epi64(sum_b, _mm_unpackhi_epi32(a, zero));
+		sum_a = _mm_add_epi64(sum_a, _mm_unpacklo_epi32(b, zero));
+		sum_b = _mm_add_epi64(sum_b, _mm_unpackhi_epi32(b, zero));
+	}
+
+	_mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(sum_a, sum_b));
+	sum = lanes[0] + lanes[1];
+
+	for (; count > 0; count--) {
+		sum += *data++;
+	}
+
+	return net_chksum_fold32(sum);
+}
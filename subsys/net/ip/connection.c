@@ -61,6 +61,32 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_HASH)
+/** Flags of a connection that is hashed on its full tuple */
+#define NET_CONN_EXACT_FLAGS (NET_CONN_REMOTE_ADDR_SPEC | \
+			      NET_CONN_REMOTE_PORT_SPEC | \
+			      NET_CONN_LOCAL_PORT_SPEC)
+
+#define CONN_HASH_MASK (CONFIG_NET_CONN_HASH_BUCKETS - 1)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+
+/* IP connections are additionally indexed for unicast demux. Connections
+ * with a remote address, remote port and local port are hashed on those
+ * and the protocol, the ones having only a local port are hashed on the
+ * protocol and local port, and the rest is kept in conn_hash_any which is
+ * always searched. As the rank of a connection is derived from the same
+ * flags, connections in different lists never have the same rank.
+ */
+static sys_slist_t conn_hash_exact[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_hash_wild[CONFIG_NET_CONN_HASH_BUCKETS];
+static sys_slist_t conn_hash_any;
+
+/* Protects the lists above so the RX path does not need conn_lock */
+static struct k_spinlock conn_hash_lock;
+#endif /* CONFIG_NET_CONN_HASH */
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -132,12 +158,81 @@ static struct net_conn *conn_get_unused(void)
 	return CONTAINER_OF(node, struct net_conn, node);
 }
 
+#if defined(CONFIG_NET_CONN_HASH)
+static uint32_t conn_hash(uint16_t proto, uint16_t local_port,
+			  uint16_t remote_port, const uint8_t *addr,
+			  size_t addr_len)
+{
+	return net_conn_hash(proto, local_port, remote_port, addr, addr_len) &
+	       CONN_HASH_MASK;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+	uint16_t remote_port = net_sin(&conn->remote_addr)->sin_port;
+
+	if (conn->family != NET_AF_INET && conn->family != NET_AF_INET6 &&
+	    conn->family != NET_AF_UNSPEC) {
+		return NULL;
+	}
+
+	if ((conn->flags & NET_CONN_EXACT_FLAGS) == NET_CONN_EXACT_FLAGS) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		    conn->remote_addr.sa_family == NET_AF_INET6) {
+			return &conn_hash_exact[conn_hash(
+				conn->proto, local_port, remote_port,
+				net_sin6(&conn->remote_addr)->sin6_addr.s6_addr,
+				sizeof(struct net_in6_addr))];
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+			   conn->remote_addr.sa_family == NET_AF_INET) {
+			return &conn_hash_exact[conn_hash(
+				conn->proto, local_port, remote_port,
+				net_sin(&conn->remote_addr)->sin_addr.s4_addr,
+				sizeof(struct net_in_addr))];
+		}
+
+		return &conn_hash_any;
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0U) {
+		return &conn_hash_wild[conn_hash(conn->proto, local_port, 0U,
+						 NULL, 0)];
+	}
+
+	return &conn_hash_any;
+}
+
+/* Must be called with conn_hash_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	conn->hash_list = conn_hash_list(conn);
+	if (conn->hash_list != NULL) {
+		sys_slist_prepend(conn->hash_list, &conn->hash_node);
+	}
+}
+
+/* Must be called with conn_hash_lock held */
+static void conn_hash_del(struct net_conn *conn)
+{
+	if (conn->hash_list != NULL) {
+		sys_slist_find_and_remove(conn->hash_list, &conn->hash_node);
+		conn->hash_list = NULL;
+	}
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static void conn_set_used(struct net_conn *conn)
 {
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	K_SPINLOCK(&conn_hash_lock) {
+		conn_hash_add(conn);
+	}
+#endif
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -463,6 +558,11 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	K_SPINLOCK(&conn_hash_lock) {
+		conn_hash_del(conn);
+	}
+#endif
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,14 +589,26 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/* The connection has to be rehashed with its new endpoints, do it
+	 * atomically so that the RX path keeps finding it.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&conn_hash_lock);
+
+	conn_hash_del(conn);
+#endif
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn_hash_add(conn);
+	k_spin_unlock(&conn_hash_lock, key);
+#endif
 
 	return ret;
 }
@@ -844,6 +956,146 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Rank of the candidate connection for a TCP/UDP packet, -1 if no match */
+static int16_t conn_match_rank(struct net_conn *conn, struct net_pkt *pkt,
+			       union net_ip_header *ip_hdr, uint8_t proto,
+			       uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return -1; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
+			      !conn->v6only && conn->type != NET_SOCK_RAW)) {
+				return -1;
+			}
+		} else {
+			return -1; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return -1; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	    (conn_family == NET_AF_INET || conn_family == NET_AF_INET6 ||
+	     conn_family == NET_AF_UNSPEC)) {
+		/* Is the candidate connection matching the packet's TCP/UDP
+		 * address and port?
+		 */
+		if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+		    net_sin(&conn->remote_addr)->sin_port != src_port) {
+			return -1; /* wrong remote port */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			return -1; /* wrong local port */
+		}
+
+		if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+			return -1; /* wrong remote address */
+		}
+
+		if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+			/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+			 * has no IPV6_V6ONLY option set and if the local IPV6 address
+			 * is unspecified, then we could accept a connection from IPv4
+			 * address by mapping it to IPv6 address.
+			 */
+			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+				if (!(conn->family == NET_AF_INET6 &&
+				      pkt_family == NET_AF_INET &&
+				      !conn->v6only &&
+				      net_ipv6_is_addr_unspecified(
+					      &net_sin6(&conn->local_addr)->sin6_addr))) {
+					return -1; /* wrong local address */
+				}
+			} else {
+				return -1; /* wrong local address */
+			}
+
+			/* We might have a match for v4-to-v6 mapping,
+			 * continue with rank checking.
+			 */
+		}
+
+		return NET_CONN_RANK(conn->flags);
+	}
+
+	return -1;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Find the best ranked connection for a unicast packet without walking
+ * all the connections or taking conn_lock.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port,
+					 net_conn_cb_t *cb, void **user_data)
+{
+	struct net_conn *best_match = NULL;
+	int16_t best_rank = -1;
+	sys_slist_t *lists[3];
+	struct net_conn *conn;
+	k_spinlock_key_t key;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == NET_AF_INET6) {
+		lists[0] = &conn_hash_exact[conn_hash(proto, dst_port, src_port,
+						      ip_hdr->ipv6->src,
+						      sizeof(struct net_in6_addr))];
+	} else {
+		lists[0] = &conn_hash_exact[conn_hash(proto, dst_port, src_port,
+						      ip_hdr->ipv4->src,
+						      sizeof(struct net_in_addr))];
+	}
+
+	lists[1] = &conn_hash_wild[conn_hash(proto, dst_port, 0U, NULL, 0)];
+	lists[2] = &conn_hash_any;
+
+	key = k_spin_lock(&conn_hash_lock);
+
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			int16_t rank = conn_match_rank(conn, pkt, ip_hdr, proto,
+						       src_port, dst_port);
+
+			if (best_rank < rank) {
+				best_rank = rank;
+				best_match = conn;
+			}
+		}
+	}
+
+	if (best_match != NULL) {
+		*cb = best_match->cb;
+		*user_data = best_match->user_data;
+	}
+
+	k_spin_unlock(&conn_hash_lock, key);
+
+	return best_match;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -907,119 +1159,56 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		is_mcast_pkt = net_ipv6_is_addr_mcast_raw(ip_hdr->ipv6->dst);
 	}
 
+#if defined(CONFIG_NET_CONN_HASH)
+	if (!is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port,
+					      dst_port, &cb, &user_data);
+		goto deliver;
+	}
+#endif /* CONFIG_NET_CONN_HASH */
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
-
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != NET_AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == NET_AF_INET6 && pkt_family == NET_AF_INET &&
-				      !conn->v6only && conn->type != NET_SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
+		int16_t rank = conn_match_rank(conn, pkt, ip_hdr, proto,
+					       src_port, dst_port);
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
+		if (best_rank < rank) {
+			struct net_pkt *mcast_pkt;
 
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
+			if (!is_mcast_pkt) {
+				best_rank = rank;
+				best_match = conn;
 
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
+				continue; /* found a match - but maybe not yet the best */
+			}
 
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == NET_AF_INET || conn_family == NET_AF_INET6 ||
-		     conn_family == NET_AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == NET_AF_INET6 &&
-					      pkt_family == NET_AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
+			mcast_pkt_delivered = true;
 		}
 	} /* loop end */
 
@@ -1030,6 +1219,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_unlock(&conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+deliver:
+#endif
 	if (is_mcast_pkt && mcast_pkt_delivered) {
 		/* As one or more multicast packets
 		 * have already been delivered in the loop above,
@@ -54,6 +54,14 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node for the demux hash table */
+	sys_snode_t hash_node;
+
+	/** Demux hash list the connection is on, NULL if none */
+	sys_slist_t *hash_list;
+#endif
+
 	/** Remote socket address */
 	struct net_sockaddr remote_addr;
 
@@ -68,7 +68,34 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "net_stats.h"
 
 #if defined(CONFIG_NET_NATIVE)
-static inline enum net_verdict process_data(struct net_pkt *pkt)
+static inline enum net_verdict process_l3(struct net_pkt *pkt)
+{
+	uint8_t family = net_pkt_family(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IP) && (family == NET_AF_INET || family == NET_AF_INET6 ||
+					  family == NET_AF_UNSPEC || family == NET_AF_PACKET)) {
+		/* IP version and header length. */
+		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
+
+		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
+			return net_ipv6_input(pkt);
+		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
+			return net_ipv4_input(pkt);
+		}
+
+		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
+		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
+		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
+		return NET_DROP;
+	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == NET_AF_CAN) {
+		return net_canbus_socket_input(pkt);
+	}
+
+	NET_DBG("Unknown protocol family packet (0x%x)", family);
+	return NET_DROP;
+}
+
+static inline enum net_verdict process_data(struct net_pkt *pkt, struct net_gro *gro)
 {
 	int ret;
 
@@ -106,35 +133,22 @@ static inline enum net_verdict process_data(struct net_pkt *pkt)
 		net_packet_socket_input(pkt, net_pkt_ll_proto_type(pkt), NET_SOCK_DGRAM);
 	}
 
-	uint8_t family = net_pkt_family(pkt);
-
-	if (IS_ENABLED(CONFIG_NET_IP) && (family == NET_AF_INET || family == NET_AF_INET6 ||
-					  family == NET_AF_UNSPEC || family == NET_AF_PACKET)) {
-		/* IP version and header length. */
-		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
-
-		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
-			return net_ipv6_input(pkt);
-		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
-			return net_ipv4_input(pkt);
-		}
-
-		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
-		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
-		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
-		return NET_DROP;
-	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == NET_AF_CAN) {
-		return net_canbus_socket_input(pkt);
+#if defined(CONFIG_NET_GRO)
+	/* The segments merged by GRO reach the IP layer when flushed */
+	if (gro != NULL && net_gro_receive(gro, pkt) == NET_OK) {
+		return NET_OK;
 	}
+#else
+	ARG_UNUSED(gro);
+#endif
 
-	NET_DBG("Unknown protocol family packet (0x%x)", family);
-	return NET_DROP;
+	return process_l3(pkt);
 }
 
-static void processing_data(struct net_pkt *pkt)
+static void processing_data(struct net_pkt *pkt, struct net_gro *gro)
 {
 again:
-	switch (process_data(pkt)) {
+	switch (process_data(pkt, gro)) {
 	case NET_CONTINUE:
 		if (IS_ENABLED(CONFIG_NET_L2_VIRTUAL)) {
 			/* If we have a tunneling packet, feed it back
@@ -157,6 +171,19 @@ again:
 	}
 }
 
+#if defined(CONFIG_NET_GRO)
+void net_process_rx_l3_packet(struct net_pkt *pkt)
+{
+	enum net_verdict verdict;
+
+	verdict = process_l3(pkt);
+	if (verdict != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+#endif /* CONFIG_NET_GRO */
+
 /* Things to setup after we are able to RX and TX */
 static void net_post_init(void)
 {
@@ -482,7 +509,7 @@ err:
 	return ret;
 }
 
-static void net_rx(struct net_if *iface, struct net_pkt *pkt)
+static void net_rx(struct net_if *iface, struct net_pkt *pkt, struct net_gro *gro)
 {
 	size_t pkt_len;
 
@@ -502,19 +529,19 @@ static void net_rx(struct net_if *iface, struct net_pkt *pkt)
 #endif
 	}
 
-	processing_data(pkt);
+	processing_data(pkt, gro);
 
 	net_print_statistics();
 	net_pkt_print();
 }
 
-void net_process_rx_packet(struct net_pkt *pkt)
+void net_process_rx_packet(struct net_pkt *pkt, struct net_gro *gro)
 {
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 	net_capture_pkt(net_pkt_iface(pkt), pkt);
 
-	net_rx(net_pkt_iface(pkt), pkt);
+	net_rx(net_pkt_iface(pkt), pkt, gro);
 }
 
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
@@ -527,7 +554,7 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
 #endif
 	if (net_tc_rx_is_immediate(tc, prio)) {
-		net_process_rx_packet(pkt);
+		net_process_rx_packet(pkt, NULL);
 	} else {
 		if (net_tc_submit_to_rx_queue(tc, pkt) != NET_OK) {
 			goto drop;
@@ -545,8 +572,8 @@ drop:
 	return;
 }
 
-/* Called by driver when a packet has been received */
-int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+int net_recv_data_deliver(struct net_if *iface, struct net_pkt *pkt,
+			  net_recv_deliver_t deliver)
 {
 	int ret;
 #if defined(CONFIG_NET_DSA) && !defined(CONFIG_NET_DSA_DEPRECATED)
@@ -594,7 +621,7 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 		net_stats_update_filter_rx_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 	} else {
-		net_queue_rx(iface, pkt);
+		deliver(iface, pkt);
 	}
 
 	ret = 0;
@@ -605,6 +632,12 @@ err:
 	return ret;
 }
 
+/* Called by driver when a packet has been received */
+int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+{
+	return net_recv_data_deliver(iface, pkt, net_queue_rx);
+}
+
 static inline void l3_init(void)
 {
 	net_pmtu_init();
@@ -651,6 +684,11 @@ static void init_rx_queues(void)
 {
 	net_tc_rx_init();
 
+#if defined(CONFIG_NET_NAPI)
+	/* Before the drivers can schedule their polling */
+	net_napi_work_q_init();
+#endif
+
 	/* Starting TX side. The ordering is important here and the TX
 	 * can only be started when RX side is ready to receive packets.
 	 */
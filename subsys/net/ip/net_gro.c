@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Generic receive offload (GRO).
+ *
+ * The in-order TCP segments of a flow received in a batch are merged into
+ * the first one: their headers are dropped and their buffers appended to
+ * it. The merged packet then goes through the IP and TCP layers once. The
+ * segments are held until the end of the batch, until a segment cannot be
+ * merged, or for at most CONFIG_NET_GRO_FLUSH_TIMEOUT microseconds.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_gro, CONFIG_NET_GRO_LOG_LEVEL);
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+
+#define GRO_TCP_PSH BIT(3)
+#define GRO_TCP_ACK BIT(4)
+
+struct gro_seg {
+	struct net_gro_key key;
+	uint32_t seq;
+	uint32_t ack;
+	uint16_t wnd;
+	uint16_t hdr_len;
+	uint16_t data_len;
+	uint8_t flags;
+};
+
+static int gro_parse_ipv4(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *hdr;
+
+	hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (hdr == NULL || hdr->vhl != 0x45 || hdr->proto != NET_IPPROTO_TCP) {
+		return -ENOTSUP;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV4H_LEN);
+	net_pkt_set_ipv4_opts_len(pkt, 0);
+
+	memcpy(&seg->key.src, hdr->src, NET_IPV4_ADDR_SIZE);
+	memcpy(&seg->key.dst, hdr->dst, NET_IPV4_ADDR_SIZE);
+	seg->key.ttl = hdr->ttl;
+
+	/* Fragments are left to the reassembly */
+	if ((net_ntohs(UNALIGNED_GET((uint16_t *)hdr->offset)) &
+	     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) != 0U) {
+		return -ENOTSUP;
+	}
+
+	/* Frames padded by the link layer are not merged */
+	if (net_ntohs(hdr->len) != net_pkt_get_len(pkt)) {
+		return -EINVAL;
+	}
+
+	if (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), NET_IF_CHECKSUM_IPV4_HEADER) &&
+	    net_calc_chksum_ipv4(pkt) != 0U) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int gro_parse_ipv6(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv6_access, struct net_ipv6_hdr);
+	struct net_ipv6_hdr *hdr;
+
+	hdr = (struct net_ipv6_hdr *)net_pkt_get_data(pkt, &ipv6_access);
+	if (hdr == NULL || (hdr->vtc & 0xf0) != 0x60 || hdr->nexthdr != NET_IPPROTO_TCP) {
+		return -ENOTSUP;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, NET_IPV6H_LEN);
+	net_pkt_set_ipv6_ext_len(pkt, 0);
+
+	memcpy(&seg->key.src, hdr->src, NET_IPV6_ADDR_SIZE);
+	memcpy(&seg->key.dst, hdr->dst, NET_IPV6_ADDR_SIZE);
+	seg->key.ttl = hdr->hop_limit;
+
+	if (net_ntohs(hdr->len) + NET_IPV6H_LEN != net_pkt_get_len(pkt)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Return 0 for a segment that can be merged, -EINVAL for a TCP segment that
+ * cannot, and -ENOTSUP for any other packet.
+ */
+static int gro_parse(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	enum net_if_checksum_type type;
+	struct net_tcp_hdr *tcp_hdr;
+	size_t tcp_hdr_len;
+	int ret;
+
+	if (net_if_l2(net_pkt_iface(pkt)) != &NET_L2_GET_NAME(ETHERNET)) {
+		return -ENOTSUP;
+	}
+
+	memset(&seg->key, 0, sizeof(seg->key));
+	seg->key.family = net_pkt_family(pkt);
+
+	net_pkt_cursor_init(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && seg->key.family == NET_AF_INET) {
+		ret = gro_parse_ipv4(pkt, seg);
+		type = NET_IF_CHECKSUM_IPV4_TCP;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && seg->key.family == NET_AF_INET6) {
+		ret = gro_parse_ipv6(pkt, seg);
+		type = NET_IF_CHECKSUM_IPV6_TCP;
+	} else {
+		return -ENOTSUP;
+	}
+
+	if (ret == -ENOTSUP) {
+		return ret;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt))) {
+		return -ENOTSUP;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (tcp_hdr == NULL) {
+		return -ENOTSUP;
+	}
+
+	seg->key.src_port = tcp_hdr->src_port;
+	seg->key.dst_port = tcp_hdr->dst_port;
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	seg->seq = net_ntohl(UNALIGNED_GET((uint32_t *)tcp_hdr->seq));
+	seg->ack = net_ntohl(UNALIGNED_GET((uint32_t *)tcp_hdr->ack));
+	seg->wnd = net_ntohs(UNALIGNED_GET((uint16_t *)tcp_hdr->wnd));
+	seg->flags = tcp_hdr->flags;
+
+	/* Only plain data segments without options are merged, anything
+	 * else needs the full TCP processing.
+	 */
+	tcp_hdr_len = (tcp_hdr->offset >> 4) * 4U;
+	if (tcp_hdr_len != sizeof(struct net_tcp_hdr) ||
+	    (seg->flags & ~GRO_TCP_PSH) != GRO_TCP_ACK) {
+		return -EINVAL;
+	}
+
+	seg->hdr_len = net_pkt_ip_hdr_len(pkt) + tcp_hdr_len;
+	seg->data_len = net_pkt_get_len(pkt) - seg->hdr_len;
+	if (seg->data_len == 0U) {
+		return -EINVAL;
+	}
+
+	/* The merged packet is not verified again by TCP */
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) &&
+	    net_calc_chksum_tcp(pkt) != 0U) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static bool gro_can_merge(struct net_gro_flow *flow, struct gro_seg *seg)
+{
+	return seg->seq == flow->next_seq && seg->ack == flow->ack &&
+	       seg->wnd == flow->wnd && seg->data_len <= flow->mss &&
+	       flow->len + seg->data_len <= CONFIG_NET_GRO_MAX_SIZE;
+}
+
+/* Drop the headers at the start of the packet, without moving its data */
+static void gro_pull_hdr(struct net_pkt *pkt, size_t len)
+{
+	while (len > 0 && pkt->buffer != NULL) {
+		struct net_buf *buf = pkt->buffer;
+		size_t pull = MIN(len, buf->len);
+
+		net_buf_pull(buf, pull);
+		len -= pull;
+
+		if (buf->len == 0U) {
+			pkt->buffer = net_buf_frag_del(NULL, buf);
+		}
+	}
+
+	net_pkt_cursor_init(pkt);
+}
+
+/* Write the length of the merged packet in its IP header */
+static int gro_update_hdr(struct net_gro_flow *flow, struct net_pkt *pkt)
+{
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && flow->key.family == NET_AF_INET) {
+		NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+		uint16_t len = net_htons(flow->len);
+		struct net_ipv4_hdr *hdr;
+
+		hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+		if (hdr == NULL) {
+			return -ENOBUFS;
+		}
+
+		/* Only the length changed, RFC1624 */
+		hdr->chksum = net_chksum_update_16(hdr->chksum, hdr->len, len);
+		hdr->len = len;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && flow->key.family == NET_AF_INET6) {
+		NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv6_access, struct net_ipv6_hdr);
+		struct net_ipv6_hdr *hdr;
+
+		hdr = (struct net_ipv6_hdr *)net_pkt_get_data(pkt, &ipv6_access);
+		if (hdr == NULL) {
+			return -ENOBUFS;
+		}
+
+		hdr->len = net_htons(flow->len - NET_IPV6H_LEN);
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return 0;
+}
+
+static void gro_flow_flush(struct net_gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->pkt;
+
+	flow->pkt = NULL;
+
+	NET_DBG("pkt %p: %u segments, %u bytes", pkt, flow->segs, flow->len);
+
+	if (flow->segs > 1U && gro_update_hdr(flow, pkt) < 0) {
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	net_pkt_set_gro_segs(pkt, flow->segs);
+	net_process_rx_l3_packet(pkt);
+}
+
+static struct net_gro_flow *gro_flow_find(struct net_gro *gro, struct net_gro_key *key)
+{
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->pkt != NULL && memcmp(&flow->key, key, sizeof(*key)) == 0) {
+			return flow;
+		}
+	}
+
+	return NULL;
+}
+
+/* Get a free flow, flushing the oldest one if there is none */
+static struct net_gro_flow *gro_flow_get(struct net_gro *gro)
+{
+	struct net_gro_flow *oldest = &gro->flows[0];
+
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->pkt == NULL) {
+			return flow;
+		}
+
+		if ((int32_t)(flow->start - oldest->start) < 0) {
+			oldest = flow;
+		}
+	}
+
+	gro_flow_flush(oldest);
+
+	return oldest;
+}
+
+enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt)
+{
+	struct net_gro_flow *flow;
+	struct gro_seg seg;
+	int ret;
+
+	ret = gro_parse(pkt, &seg);
+	net_pkt_cursor_init(pkt);
+
+	if (ret == -ENOTSUP) {
+		return NET_CONTINUE;
+	}
+
+	flow = gro_flow_find(gro, &seg.key);
+	if (flow != NULL) {
+		if (ret == 0 && gro_can_merge(flow, &seg)) {
+			gro_pull_hdr(pkt, seg.hdr_len);
+			net_pkt_append_buffer(flow->pkt, pkt->buffer);
+			pkt->buffer = NULL;
+			net_pkt_unref(pkt);
+
+			flow->len += seg.data_len;
+			flow->next_seq += seg.data_len;
+			flow->segs++;
+
+			/* The sender flushed its data, so do we */
+			if ((seg.flags & GRO_TCP_PSH) || flow->segs == UINT8_MAX ||
+			    flow->len + flow->mss > CONFIG_NET_GRO_MAX_SIZE) {
+				gro_flow_flush(flow);
+			}
+
+			return NET_OK;
+		}
+
+		/* Keep the segments of the flow in order */
+		gro_flow_flush(flow);
+	}
+
+	if (ret < 0 || (seg.flags & GRO_TCP_PSH)) {
+		return NET_CONTINUE;
+	}
+
+	flow = gro_flow_get(gro);
+	flow->pkt = pkt;
+	flow->key = seg.key;
+	flow->start = k_cycle_get_32();
+	flow->next_seq = seg.seq + seg.data_len;
+	flow->ack = seg.ack;
+	flow->wnd = seg.wnd;
+	flow->mss = seg.data_len;
+	flow->len = net_pkt_get_len(pkt);
+	flow->segs = 1U;
+
+	return NET_OK;
+}
+
+void net_gro_flush(struct net_gro *gro, bool all)
+{
+	uint32_t now = k_cycle_get_32();
+
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->pkt == NULL) {
+			continue;
+		}
+
+		if (all ||
+		    k_cyc_to_us_floor32(now - flow->start) >= CONFIG_NET_GRO_FLUSH_TIMEOUT) {
+			gro_flow_flush(flow);
+		}
+	}
+}
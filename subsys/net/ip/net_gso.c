@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Software generic segmentation offload (GSO).
+ *
+ * TCP may hand down packets carrying more data than fits in the MTU, with
+ * net_pkt_gso_size() telling the data size of each segment. Such a packet
+ * goes through the IP and L2 layers once, and unless the device segments it
+ * itself, it is cut here just before being given to the driver.
+ *
+ * Only the headers are copied into each segment, the data buffers are moved
+ * from the packet to the segments. Just the bytes of a buffer crossing a
+ * segment boundary are copied.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_gso, CONFIG_NET_GSO_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+
+/* Timeout for the segment allocations */
+#define GSO_ALLOC_TIMEOUT K_MSEC(100)
+
+/* Flags only kept in the last segment */
+#define GSO_TCP_FIN BIT(0)
+#define GSO_TCP_PSH BIT(3)
+
+static int gso_tcp_hdr_get(struct net_pkt *pkt, size_t ip_hdr_len,
+			   size_t *tcp_hdr_len, uint32_t *seq, uint8_t *flags)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, ip_hdr_len)) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(pkt, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	*tcp_hdr_len = (tcp_hdr->offset >> 4) * 4U;
+	*seq = net_ntohl(UNALIGNED_GET((uint32_t *)tcp_hdr->seq));
+	*flags = tcp_hdr->flags;
+
+	return 0;
+}
+
+/* Detach the data buffers from the packet so that they can be moved to the
+ * segments. This is only done if no buffer is shared and the data starts in
+ * its own buffer, as TCP builds it. Otherwise NULL is returned and the data
+ * is copied.
+ */
+static struct net_buf *gso_data_detach(struct net_pkt *pkt, size_t hdr_len)
+{
+	struct net_buf *prev = NULL;
+	struct net_buf *buf;
+	size_t len = 0;
+
+	for (buf = pkt->buffer; buf != NULL; buf = buf->frags) {
+		if (buf->ref > 1) {
+			return NULL;
+		}
+	}
+
+	for (buf = pkt->buffer; buf != NULL && len < hdr_len; buf = buf->frags) {
+		len += buf->len;
+		prev = buf;
+	}
+
+	if (prev == NULL || buf == NULL || len != hdr_len) {
+		return NULL;
+	}
+
+	prev->frags = NULL;
+
+	return buf;
+}
+
+/* Move len bytes of data from the head of the data chain to the segment */
+static int gso_data_move(struct net_pkt *seg, struct net_buf **data, size_t len)
+{
+	while (len > 0) {
+		struct net_buf *buf = *data;
+		struct net_buf *frag;
+
+		if (buf == NULL) {
+			return -ENOBUFS;
+		}
+
+		if (buf->len <= len) {
+			*data = buf->frags;
+			buf->frags = NULL;
+			len -= buf->len;
+
+			net_pkt_append_buffer(seg, buf);
+			continue;
+		}
+
+		/* The buffer is shared with the next segment */
+		frag = net_pkt_get_frag(seg, len, GSO_ALLOC_TIMEOUT);
+		if (!frag) {
+			return -ENOBUFS;
+		}
+
+		net_buf_add_mem(frag, buf->data, len);
+		net_buf_pull(buf, len);
+		len = 0;
+
+		net_pkt_append_buffer(seg, frag);
+	}
+
+	return 0;
+}
+
+/* Set the sequence number and flags of a segment, then its lengths and
+ * checksums.
+ */
+static int gso_tcp_finalize(struct net_pkt *seg, size_t ip_hdr_len,
+			    uint32_t seq, uint8_t flags)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct net_tcp_hdr);
+	struct net_tcp_hdr *tcp_hdr;
+
+	net_pkt_cursor_init(seg);
+	net_pkt_set_overwrite(seg, true);
+
+	if (net_pkt_skip(seg, ip_hdr_len)) {
+		return -ENOBUFS;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)net_pkt_get_data(seg, &tcp_access);
+	if (!tcp_hdr) {
+		return -ENOBUFS;
+	}
+
+	UNALIGNED_PUT(net_htonl(seq), (uint32_t *)tcp_hdr->seq);
+	tcp_hdr->flags = flags;
+
+	if (net_pkt_set_data(seg, &tcp_access)) {
+		return -ENOBUFS;
+	}
+
+	/* The IPv4 identification is kept as is, TCP sends its packets with
+	 * an identification of 0 whether they are segmented here or not.
+	 */
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == NET_AF_INET) {
+		return net_ipv4_finalize(seg, NET_IPPROTO_TCP);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == NET_AF_INET6) {
+		return net_ipv6_finalize(seg, NET_IPPROTO_TCP);
+	}
+
+	return -EAFNOSUPPORT;
+}
+
+int net_gso_segment(struct net_pkt *pkt, net_gso_send_t send, void *user_data)
+{
+	size_t ip_hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t mss = net_pkt_gso_size(pkt);
+	struct net_buf *data;
+	bool moved;
+	size_t tcp_hdr_len;
+	size_t hdr_len;
+	size_t data_len;
+	uint32_t seq;
+	uint8_t flags;
+	int sent = 0;
+	int ret;
+
+	ret = gso_tcp_hdr_get(pkt, ip_hdr_len, &tcp_hdr_len, &seq, &flags);
+	if (ret < 0) {
+		return ret;
+	}
+
+	hdr_len = ip_hdr_len + tcp_hdr_len;
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+
+	data = gso_data_detach(pkt, hdr_len);
+	moved = data != NULL;
+
+	NET_DBG("pkt %p: %zu bytes in segments of %u (%s)", pkt, data_len, mss,
+		moved ? "moved" : "copied");
+
+	for (size_t offset = 0; offset < data_len; offset += mss) {
+		size_t len = MIN(mss, data_len - offset);
+		bool last = offset + len == data_len;
+		struct net_pkt *seg;
+
+		if (moved) {
+			seg = net_pkt_clone_segment(pkt, hdr_len, hdr_len, 0,
+						    GSO_ALLOC_TIMEOUT);
+			if (seg && gso_data_move(seg, &data, len) < 0) {
+				net_pkt_unref(seg);
+				seg = NULL;
+			}
+		} else {
+			seg = net_pkt_clone_segment(pkt, hdr_len, hdr_len + offset,
+						    len, GSO_ALLOC_TIMEOUT);
+		}
+
+		if (!seg) {
+			NET_DBG("pkt %p: cannot allocate segment at %zu", pkt, offset);
+			ret = -ENOBUFS;
+			goto out;
+		}
+
+		ret = gso_tcp_finalize(seg, ip_hdr_len, seq + offset,
+				       last ? flags : flags & ~(GSO_TCP_FIN | GSO_TCP_PSH));
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			goto out;
+		}
+
+		ret = send(seg, user_data);
+		if (ret < 0) {
+			goto out;
+		}
+
+		sent += ret;
+	}
+
+	ret = sent;
+
+out:
+	/* Data not handed to a segment, if any */
+	if (data != NULL) {
+		net_buf_unref(data);
+	}
+
+	return ret;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Budgeted polling of the received packets.
+ *
+ * A driver keeps its receive interrupt disabled while it is polled, and the
+ * packets it receives are processed at once in the poll thread instead of
+ * being queued one by one. When a poll function uses up its budget, its
+ * device is polled again after the other scheduled devices.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_napi, CONFIG_NET_NAPI_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+
+#if defined(CONFIG_NET_TC_THREAD_COOPERATIVE)
+#define NAPI_THREAD_PRIORITY K_PRIO_COOP(CONFIG_NET_NAPI_THREAD_PRIO)
+#else
+#define NAPI_THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NET_NAPI_THREAD_PRIO)
+#endif
+
+static K_KERNEL_STACK_DEFINE(napi_stack, CONFIG_NET_NAPI_STACK_SIZE);
+static struct k_work_q napi_work_q;
+
+#if defined(CONFIG_NET_GRO)
+/* All the devices are polled from the same thread */
+static struct net_gro napi_gro;
+#define NAPI_GRO (&napi_gro)
+#else
+#define NAPI_GRO NULL
+#endif
+
+static void napi_poll(struct k_work *work)
+{
+	struct net_napi *napi = CONTAINER_OF(work, struct net_napi, work);
+	int done;
+
+	done = napi->poll(napi, CONFIG_NET_NAPI_BUDGET);
+
+	NET_DBG("iface %d: %d packets", net_if_get_by_iface(napi->iface), done);
+
+#if defined(CONFIG_NET_GRO)
+	/* The batch ends with the poll */
+	net_gro_flush(&napi_gro, true);
+#endif
+
+	if (done >= CONFIG_NET_NAPI_BUDGET) {
+		k_work_submit_to_queue(&napi_work_q, &napi->work);
+	}
+}
+
+void net_napi_init(struct net_napi *napi, struct net_if *iface, net_napi_poll_t poll)
+{
+	k_work_init(&napi->work, napi_poll);
+	napi->iface = iface;
+	napi->poll = poll;
+	atomic_clear(&napi->scheduled);
+}
+
+void net_napi_schedule(struct net_napi *napi)
+{
+	if (!atomic_set(&napi->scheduled, 1)) {
+		k_work_submit_to_queue(&napi_work_q, &napi->work);
+	}
+}
+
+void net_napi_complete(struct net_napi *napi)
+{
+	atomic_clear(&napi->scheduled);
+}
+
+/* The polled packets are processed at once in the poll thread */
+static void napi_deliver(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+
+	net_process_rx_packet(pkt, NAPI_GRO);
+}
+
+int net_napi_receive(struct net_napi *napi, struct net_pkt *pkt)
+{
+	return net_recv_data_deliver(napi->iface, pkt, napi_deliver);
+}
+
+void net_napi_work_q_init(void)
+{
+	struct k_work_queue_config q_cfg = {
+		.name = "net_napi",
+		.no_yield = false,
+	};
+
+	k_work_queue_init(&napi_work_q);
+	k_work_queue_start(&napi_work_q, napi_stack, K_KERNEL_STACK_SIZEOF(napi_stack),
+			   NAPI_THREAD_PRIORITY, &q_cfg);
+}
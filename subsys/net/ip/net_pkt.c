@@ -608,7 +608,12 @@ done:
 	}
 
 	if (pkt->frags) {
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 		net_pkt_frag_unref(pkt->frags);
+#else
+		/* Give the buffers back to their pool all at once */
+		net_buf_unref_chain_bulk(&pkt->frags, 1);
+#endif
 	}
 
 	if (IS_ENABLED(CONFIG_NET_DEBUG_NET_PKT_NON_FRAGILE_ACCESS)) {
@@ -924,6 +929,9 @@ static struct net_pkt_alloc_stats_slab *find_alloc_stats(struct k_mem_slab *slab
 
 #if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
 
+/* Maximum number of buffers allocated at once for a packet */
+#define PKT_ALLOC_BULK_MAX 8
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 static struct net_buf *pkt_alloc_buffer(struct net_pkt *pkt,
 					struct net_buf_pool *pool,
@@ -945,55 +953,66 @@ static struct net_buf *pkt_alloc_buffer(struct net_pkt *pkt,
 #endif
 
 	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t buf_size = pool->alloc->max_alloc_size;
+	struct net_buf *bufs[PKT_ALLOC_BULK_MAX];
 	struct net_buf *first = NULL;
 	struct net_buf *current = NULL;
 
 	do {
-		struct net_buf *new;
+		/* Get all the buffers still needed at once, up to the
+		 * batch size.
+		 */
+		size_t needed = DIV_ROUND_UP(first ? size : size + headroom, buf_size);
+		size_t count;
 
-		new = net_buf_alloc_fixed(pool, timeout);
-		if (!new) {
+		count = net_buf_alloc_bulk(pool, buf_size, bufs,
+					   CLAMP(needed, 1, ARRAY_SIZE(bufs)), timeout);
+		if (!count) {
 			goto error;
 		}
 
-		if (!first && !current) {
-			first = new;
-		} else {
-			current->frags = new;
-		}
-
-		current = new;
-
-		/* If there is headroom reserved, then allocate that to the
-		 * first buf.
-		 */
-		if (current == first && headroom > 0) {
-			if (current->size > (headroom + size)) {
-				current->size = size + headroom;
+		for (size_t i = 0; i < count; i++) {
+			struct net_buf *new = bufs[i];
 
-				size = 0U;
+			if (!first && !current) {
+				first = new;
 			} else {
-				size -= current->size - headroom;
-			}
-		} else {
-			if (current->size > size) {
-				current->size = size;
+				current->frags = new;
 			}
 
-			size -= current->size;
-		}
+			current = new;
 
-		timeout = sys_timepoint_timeout(end);
+			/* If there is headroom reserved, then allocate that
+			 * to the first buf.
+			 */
+			if (current == first && headroom > 0) {
+				if (current->size > (headroom + size)) {
+					current->size = size + headroom;
+
+					size = 0U;
+				} else {
+					size -= current->size - headroom;
+				}
+			} else {
+				if (current->size > size) {
+					current->size = size;
+				}
+
+				size -= current->size;
+			}
 
 #if CONFIG_NET_PKT_LOG_LEVEL >= LOG_LEVEL_DBG
-		NET_FRAG_CHECK_IF_NOT_IN_USE(new, new->ref + 1);
+			NET_FRAG_CHECK_IF_NOT_IN_USE(new, new->ref + 1);
 
-		net_pkt_alloc_add(new, false, caller, line);
+			net_pkt_alloc_add(new, false, caller, line);
 
-		NET_DBG("%s (%s) [%d] frag %p ref %d (%s():%d)",
-			pool2str(pool), get_name(pool), get_frees(pool),
-			new, new->ref, caller, line);
+			NET_DBG("%s (%s) [%d] frag %p ref %d (%s():%d)",
+				pool2str(pool), get_name(pool), get_frees(pool),
+				new, new->ref, caller, line);
 #endif
+		}
+
+		timeout = sys_timepoint_timeout(end);
 	} while (size);
 
 #if defined(CONFIG_NET_PKT_ALLOC_STATS)
@@ -2088,6 +2107,8 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_ip_reassembled(pkt, net_pkt_is_ip_reassembled(pkt));
 	net_pkt_set_cooked_mode(clone_pkt, net_pkt_is_cooked_mode(pkt));
 	net_pkt_set_ipv4_pmtu(clone_pkt, net_pkt_ipv4_pmtu(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
+	net_pkt_set_gro_segs(clone_pkt, net_pkt_gro_segs(pkt));
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
@@ -2211,6 +2232,38 @@ struct net_pkt *net_pkt_shallow_clone(struct net_pkt *pkt, k_timeout_t timeout)
 	return clone_pkt;
 }
 
+#if defined(CONFIG_NET_GSO)
+struct net_pkt *net_pkt_clone_segment(struct net_pkt *pkt, size_t hdr_len,
+				      size_t offset, size_t len,
+				      k_timeout_t timeout)
+{
+	struct net_pkt *seg;
+
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len + len,
+					NET_AF_UNSPEC, 0, timeout);
+	if (!seg) {
+		return NULL;
+	}
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, offset - hdr_len) ||
+	    net_pkt_copy(seg, pkt, len)) {
+		net_pkt_unref(seg);
+		return NULL;
+	}
+
+	clone_pkt_attributes(pkt, seg);
+	net_pkt_set_gso_size(seg, 0);
+
+	net_pkt_cursor_init(seg);
+
+	return seg;
+}
+#endif /* CONFIG_NET_GSO */
+
 size_t net_pkt_remaining_data(struct net_pkt *pkt)
 {
 	struct net_buf *buf;
@@ -61,7 +61,30 @@ extern void net_if_post_init(void);
 extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
 extern const char *net_if_oper_state2str(enum net_if_oper_state state);
-extern void net_process_rx_packet(struct net_pkt *pkt);
+struct net_gro;
+extern void net_process_rx_packet(struct net_pkt *pkt, struct net_gro *gro);
+
+/** Hand a received packet over for processing, in a queue or at once */
+typedef void (*net_recv_deliver_t)(struct net_if *iface, struct net_pkt *pkt);
+
+/**
+ * @brief Check a packet received by a driver and deliver it
+ *
+ * Common part of net_recv_data() and net_napi_receive(): the DSA conduit
+ * redirection, the tracing, the sanity checks and the receive filters.
+ *
+ * @param iface Interface the packet was received on
+ * @param pkt Received packet
+ * @param deliver Called with the packet if it passes the checks and filters
+ *
+ * @return 0 if the packet was delivered or filtered out, a negative error
+ *         if it was not taken
+ */
+extern int net_recv_data_deliver(struct net_if *iface, struct net_pkt *pkt,
+				 net_recv_deliver_t deliver);
+#if defined(CONFIG_NET_NAPI)
+extern void net_napi_work_q_init(void);
+#endif
 extern void net_process_tx_packet(struct net_pkt *pkt);
 
 extern struct net_if_addr *net_if_ipv4_addr_get_first_by_index(int ifindex);
@@ -296,6 +319,134 @@ int net_ipv6_send_fragmented_pkt(struct net_if *iface, struct net_pkt *pkt,
 				 uint16_t pkt_len, uint16_t mtu);
 #endif
 
+#if defined(CONFIG_NET_GSO)
+/**
+ * @brief Create a packet from the headers of a packet and a part of its data
+ *
+ * A length of 0 only copies the headers.
+ *
+ * @param pkt Packet to copy from, its cursor is moved
+ * @param hdr_len Length of the headers at the start of the packet
+ * @param offset Offset of the data to copy, from the start of the packet
+ * @param len Length of the data to copy
+ * @param timeout Allocation timeout
+ *
+ * @return The new packet, or NULL if it cannot be allocated
+ */
+struct net_pkt *net_pkt_clone_segment(struct net_pkt *pkt, size_t hdr_len,
+				      size_t offset, size_t len,
+				      k_timeout_t timeout);
+
+/** Send a segment, the function takes ownership of the segment */
+typedef int (*net_gso_send_t)(struct net_pkt *seg, void *user_data);
+
+/**
+ * @brief Cut a TCP packet into segments of net_pkt_gso_size() bytes of data
+ *
+ * The packet must start with its IP header. Each segment gets a copy of the
+ * IP and TCP headers with its own length, sequence number and checksums.
+ * When the data starts in its own, unshared, buffer, the data buffers are
+ * moved to the segments instead of being copied, leaving the packet with
+ * its headers only. The packet itself is left to the caller.
+ *
+ * @param pkt Packet to segment
+ * @param send Function called with each segment in order
+ * @param user_data Passed to the send function
+ *
+ * @return Number of bytes sent, or a negative error if a segment could not
+ *         be created or sent
+ */
+int net_gso_segment(struct net_pkt *pkt, net_gso_send_t send, void *user_data);
+#endif /* CONFIG_NET_GSO */
+
+#if defined(CONFIG_NET_GRO)
+/** TCP flow the segments held by GRO belong to */
+struct net_gro_key {
+	struct net_in6_addr src;
+	struct net_in6_addr dst;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t family;
+	uint8_t ttl;
+};
+
+/** Segments of a flow merged by GRO */
+struct net_gro_flow {
+	/** First segment, the data of the next ones is appended to it */
+	struct net_pkt *pkt;
+	struct net_gro_key key;
+	/** Cycle count when the first segment was held */
+	uint32_t start;
+	/** Sequence number of the next in-order segment */
+	uint32_t next_seq;
+	uint32_t ack;
+	uint16_t wnd;
+	/** Data length of the first segment, no merged segment is larger */
+	uint16_t mss;
+	/** Length of the merged packet, IP header included */
+	uint16_t len;
+	uint8_t segs;
+};
+
+/** GRO state of a receive context, like a RX queue thread */
+struct net_gro {
+	struct net_gro_flow flows[CONFIG_NET_GRO_FLOWS];
+};
+
+/**
+ * @brief Hold or merge a received packet processed by L2
+ *
+ * @param gro GRO state of the caller
+ * @param pkt Received packet starting with its IP header
+ *
+ * @return NET_OK if the packet was taken, NET_CONTINUE if it is to be
+ * processed as usual.
+ */
+enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt);
+
+/**
+ * @brief Give the held packets to the IP layer
+ *
+ * @param gro GRO state of the caller
+ * @param all Flush all the packets at the end of a batch, or only those
+ * held for CONFIG_NET_GRO_FLUSH_TIMEOUT microseconds
+ */
+void net_gro_flush(struct net_gro *gro, bool all);
+
+/** Process a packet held by GRO, from its IP header on */
+void net_process_rx_l3_packet(struct net_pkt *pkt);
+#endif /* CONFIG_NET_GRO */
+
+/**
+ * @brief Hash the ports and the remote address of a connection
+ *
+ * Used to index the connection handler and TCP connection hash tables.
+ *
+ * @param proto Protocol, or 0 if not part of the key
+ * @param local_port Local port, in network byte order
+ * @param remote_port Remote port, in network byte order
+ * @param addr Remote address, or NULL if not part of the key
+ * @param addr_len Length of the remote address
+ *
+ * @return Hash, to be masked with the table size
+ */
+static inline uint32_t net_conn_hash(uint16_t proto, uint16_t local_port,
+				     uint16_t remote_port, const uint8_t *addr,
+				     size_t addr_len)
+{
+	uint32_t hash = ((uint32_t)local_port << 16) ^ remote_port ^ proto;
+
+	for (size_t i = 0; i < addr_len; i++) {
+		hash = hash * 31U + addr[i];
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x45d9f3bU;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
 extern const char *net_verdict2str(enum net_verdict verdict);
 extern const char *net_proto2str(int family, int proto);
 extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
@@ -304,6 +455,90 @@ extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 extern uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
 
+#if !defined(CONFIG_NET_CHKSUM_GENERIC)
+/* Architecture specific sum of @a count 32-bit words read from the 4-byte
+ * aligned @a data. The result is congruent to the sum of the words modulo
+ * 0xffff, and is zero only if all the words are.
+ */
+extern uint32_t net_chksum_words(const uint32_t *data, size_t count);
+
+/* Fold a 64-bit sum of words into 32 bits, keeping it non-zero */
+static inline uint32_t net_chksum_fold32(uint64_t sum)
+{
+	sum = (sum & UINT32_MAX) + (sum >> 32);
+	sum = (sum & UINT32_MAX) + (sum >> 32);
+
+	return (uint32_t)sum;
+}
+#endif
+
+/**
+ * @brief Update an Internet checksum after a 16-bit word it covers changed,
+ *        as in RFC 1624 eqn. 3: HC' = ~(~HC + ~m + m').
+ *
+ * The checksum and the words can be given in either byte order, as long as
+ * it is the same for all of them, e.g. as they are stored in the packet.
+ *
+ * @param chksum Checksum before the change
+ * @param old_val Previous value of the word
+ * @param new_val New value of the word
+ *
+ * @return Checksum after the change
+ */
+static inline uint16_t net_chksum_update_16(uint16_t chksum, uint16_t old_val,
+					    uint16_t new_val)
+{
+	uint32_t sum = (uint16_t)~chksum;
+
+	sum += (uint16_t)~old_val;
+	sum += new_val;
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+
+	return (uint16_t)~sum;
+}
+
+/**
+ * @brief Update an Internet checksum after a 32-bit word it covers changed,
+ *        e.g. an IPv4 address.
+ *
+ * @param chksum Checksum before the change
+ * @param old_val Previous value of the word
+ * @param new_val New value of the word
+ *
+ * @return Checksum after the change
+ */
+static inline uint16_t net_chksum_update_32(uint16_t chksum, uint32_t old_val,
+					    uint32_t new_val)
+{
+	chksum = net_chksum_update_16(chksum, old_val >> 16, new_val >> 16);
+
+	return net_chksum_update_16(chksum, old_val & 0xffff, new_val & 0xffff);
+}
+
+/**
+ * @brief Update an Internet checksum after a range of 16-bit aligned data
+ *        it covers changed, e.g. an IPv6 address.
+ *
+ * @param chksum Checksum before the change
+ * @param old_data Previous data
+ * @param new_data New data
+ * @param len Length of the data, a multiple of 2
+ *
+ * @return Checksum after the change
+ */
+static inline uint16_t net_chksum_update(uint16_t chksum, const uint8_t *old_data,
+					 const uint8_t *new_data, size_t len)
+{
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		chksum = net_chksum_update_16(chksum,
+					      UNALIGNED_GET((const uint16_t *)&old_data[i]),
+					      UNALIGNED_GET((const uint16_t *)&new_data[i]));
+	}
+
+	return chksum;
+}
+
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
  *        to the upper layers
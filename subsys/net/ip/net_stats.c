@@ -167,6 +167,9 @@ static inline void stats(struct net_if *iface)
 			 GET_STAT(iface, tcp.rsterr),
 			 GET_STAT(iface, tcp.rst),
 			 GET_STAT(iface, tcp.rexmit));
+		NET_INFO("TCP fast rexmit %u\trto\t%u",
+			 GET_STAT(iface, tcp.fast_rexmit),
+			 GET_STAT(iface, tcp.rto));
 		NET_INFO("TCP conn drop  %u\tconnrst\t%u",
 			 GET_STAT(iface, tcp.conndrop),
 			 GET_STAT(iface, tcp.connrst));
@@ -262,6 +262,9 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 	struct k_sem *fifo_slot = p2;
 #else
 	ARG_UNUSED(p2);
+#endif
+#if defined(CONFIG_NET_GRO)
+	struct net_gro gro = { 0 };
 #endif
 	struct net_pkt *pkt;
 
@@ -275,7 +278,14 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 		k_sem_give(fifo_slot);
 #endif
 
-		net_process_rx_packet(pkt);
+#if defined(CONFIG_NET_GRO)
+		net_process_rx_packet(pkt, &gro);
+
+		/* The batch ends when the queue is empty */
+		net_gro_flush(&gro, k_fifo_is_empty(fifo));
+#else
+		net_process_rx_packet(pkt, NULL);
+#endif
 	}
 }
 #endif
@@ -16,6 +16,8 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 #include <limits.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
 
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_core.h>
@@ -32,7 +34,7 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 /* We keep track of the routes in a separate list so that we can remove
  * the oldest routes (at tail) if needed.
  */
-static sys_slist_t routes;
+static sys_dlist_t routes = SYS_DLIST_STATIC_INIT(&routes);
 
 /* Track currently active route lifetime timers */
 static sys_slist_t active_route_lifetime_timers;
@@ -263,19 +265,250 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
-	sys_slist_find_and_remove(&routes, &route->node);
-	sys_slist_prepend(&routes, &route->node);
+	if (sys_dnode_is_linked(&route->node)) {
+		sys_dlist_remove(&route->node);
+	}
+
+	sys_dlist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct net_in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_LPM)
+/* Path compressed binary trie indexing the routes by prefix. A node either
+ * carries the routes having exactly its prefix, or is a branching node with
+ * two children. A trie holding N distinct prefixes therefore never needs
+ * more than 2 * N - 1 nodes. The trie is protected by the IPv6 neighbor lock.
+ */
+struct route_lpm_node {
+	struct route_lpm_node *parent;
+	struct route_lpm_node *child[2];
+
+	/* Routes with this exact prefix, or free list linkage */
+	union {
+		sys_slist_t routes;
+		sys_snode_t free_node;
+	};
+
+	struct net_in6_addr prefix;
+	uint8_t len;
+};
+
+#define ROUTE_LPM_NODES (2 * CONFIG_NET_MAX_ROUTES)
+#define ROUTE_LPM_MAX_LEN (sizeof(struct net_in6_addr) * 8)
+
+static struct route_lpm_node route_lpm_pool[ROUTE_LPM_NODES];
+static sys_slist_t route_lpm_free;
+static struct route_lpm_node *route_lpm_root;
+
+static inline uint8_t route_lpm_bit(const struct net_in6_addr *addr,
+				    uint8_t pos)
+{
+	return (addr->s6_addr[pos / 8] >> (7 - (pos % 8))) & 1U;
+}
+
+/* Number of leading bits that are the same in both addresses, up to max */
+static uint8_t route_lpm_common_len(const struct net_in6_addr *a,
+				    const struct net_in6_addr *b,
+				    uint8_t max)
+{
+	uint8_t len = 0U;
+
+	while (len < max) {
+		uint8_t diff = a->s6_addr[len / 8] ^ b->s6_addr[len / 8];
+
+		if (diff == 0U) {
+			len += 8U;
+			continue;
+		}
+
+		len += u32_count_leading_zeros(diff) - (32 - 8);
+		break;
+	}
+
+	return MIN(len, max);
+}
+
+static struct route_lpm_node *route_lpm_node_alloc(const struct net_in6_addr *prefix,
+						   uint8_t len)
+{
+	struct route_lpm_node *node;
+	sys_snode_t *free_node;
+
+	free_node = sys_slist_get(&route_lpm_free);
+	if (free_node == NULL) {
+		return NULL;
+	}
+
+	node = CONTAINER_OF(free_node, struct route_lpm_node, free_node);
+
+	node->parent = NULL;
+	node->child[0] = NULL;
+	node->child[1] = NULL;
+	sys_slist_init(&node->routes);
+	net_ipaddr_copy(&node->prefix, prefix);
+	node->len = len;
+
+	return node;
+}
+
+static inline void route_lpm_node_free(struct route_lpm_node *node)
+{
+	sys_slist_prepend(&route_lpm_free, &node->free_node);
+}
+
+static inline struct route_lpm_node **route_lpm_link(struct route_lpm_node *node)
+{
+	if (node->parent == NULL) {
+		return &route_lpm_root;
+	}
+
+	return &node->parent->child[route_lpm_bit(&node->prefix,
+						  node->parent->len)];
+}
+
+static int route_lpm_insert(struct net_route_entry *route)
+{
+	const struct net_in6_addr *key = &route->addr;
+	uint8_t len = MIN(route->prefix_len, ROUTE_LPM_MAX_LEN);
+	struct route_lpm_node **link = &route_lpm_root;
+	struct route_lpm_node *parent = NULL;
+	struct route_lpm_node *node, *leaf, *branch;
+	uint8_t common = 0U;
+
+	while (*link != NULL) {
+		node = *link;
+
+		common = route_lpm_common_len(&node->prefix, key,
+					      MIN(node->len, len));
+		if (common < node->len) {
+			break;
+		}
+
+		if (node->len == len) {
+			sys_slist_prepend(&node->routes, &route->lpm_node);
+			return 0;
+		}
+
+		parent = node;
+		link = &node->child[route_lpm_bit(key, node->len)];
+	}
+
+	leaf = route_lpm_node_alloc(key, len);
+	if (leaf == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_slist_prepend(&leaf->routes, &route->lpm_node);
+	leaf->parent = parent;
+
+	node = *link;
+	if (node == NULL) {
+		*link = leaf;
+		return 0;
+	}
+
+	if (common == len) {
+		/* The new prefix covers the existing subtree */
+		leaf->child[route_lpm_bit(&node->prefix, len)] = node;
+		node->parent = leaf;
+		*link = leaf;
+		return 0;
+	}
+
+	/* The prefixes diverge, a branching node is needed */
+	branch = route_lpm_node_alloc(key, common);
+	if (branch == NULL) {
+		route_lpm_node_free(leaf);
+		return -ENOMEM;
+	}
+
+	branch->parent = parent;
+	branch->child[route_lpm_bit(key, common)] = leaf;
+	branch->child[route_lpm_bit(&node->prefix, common)] = node;
+	leaf->parent = branch;
+	node->parent = branch;
+	*link = branch;
+
+	return 0;
+}
+
+static void route_lpm_remove(struct net_route_entry *route)
+{
+	const struct net_in6_addr *key = &route->addr;
+	uint8_t len = MIN(route->prefix_len, ROUTE_LPM_MAX_LEN);
+	struct route_lpm_node *node = route_lpm_root;
+
+	while (node != NULL && node->len < len) {
+		node = node->child[route_lpm_bit(key, node->len)];
+	}
+
+	if (node == NULL || node->len != len ||
+	    route_lpm_common_len(&node->prefix, key, len) != len ||
+	    !sys_slist_find_and_remove(&node->routes, &route->lpm_node)) {
+		return;
+	}
+
+	/* Collapse the nodes that are no longer needed */
+	while (node != NULL && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		struct route_lpm_node *child = node->child[0] ?
+					       node->child[0] : node->child[1];
+		struct route_lpm_node *parent = node->parent;
+
+		*route_lpm_link(node) = child;
+		if (child != NULL) {
+			child->parent = parent;
+		}
+
+		route_lpm_node_free(node);
+		node = parent;
+	}
+}
+
+static struct net_route_entry *route_lpm_lookup(struct net_if *iface,
+						const struct net_in6_addr *dst)
+{
+	struct route_lpm_node *node = route_lpm_root;
+	struct net_route_entry *found = NULL;
+
+	while (node != NULL &&
+	       route_lpm_common_len(&node->prefix, dst, node->len) == node->len) {
+		struct net_route_entry *route;
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, lpm_node) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->len == ROUTE_LPM_MAX_LEN) {
+			break;
+		}
+
+		node = node->child[route_lpm_bit(dst, node->len)];
+	}
+
+	return found;
+}
+
+static void route_lpm_init(void)
+{
+	route_lpm_root = NULL;
+	sys_slist_init(&route_lpm_free);
+
+	for (int i = 0; i < ROUTE_LPM_NODES; i++) {
+		sys_slist_prepend(&route_lpm_free, &route_lpm_pool[i].free_node);
+	}
+}
+
+#else
+static struct net_route_entry *route_table_lookup(struct net_if *iface,
+						  const struct net_in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -298,6 +531,23 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_LPM */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct net_in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+#if defined(CONFIG_NET_ROUTE_LPM)
+	found = route_lpm_lookup(iface, dst);
+#else
+	found = route_table_lookup(iface, dst);
+#endif
+
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -393,9 +643,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	nbr = nbr_new(iface, addr, prefix_len);
 	if (!nbr) {
 		/* Remove the oldest route and try again */
-		sys_snode_t *last = sys_slist_peek_tail(&routes);
-
-		sys_slist_find_and_remove(&routes, last);
+		sys_dnode_t *last = sys_dlist_peek_tail(&routes);
 
 		route = CONTAINER_OF(last,
 				     struct net_route_entry,
@@ -444,7 +692,12 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	net_route_update_lifetime(route, lifetime);
 
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_prepend(&routes, &route->node);
+
+#if defined(CONFIG_NET_ROUTE_LPM)
+	/* Cannot fail, the trie has room for twice the number of routes */
+	(void)route_lpm_insert(route);
+#endif
 
 	tmp = nbr_nexthop_get(iface, nexthop);
 
@@ -586,7 +839,13 @@ int net_route_del(struct net_route_entry *route)
 		}
 	}
 
-	sys_slist_find_and_remove(&routes, &route->node);
+	if (sys_dnode_is_linked(&route->node)) {
+		sys_dlist_remove(&route->node);
+
+#if defined(CONFIG_NET_ROUTE_LPM)
+		route_lpm_remove(route);
+#endif
+	}
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
@@ -1154,6 +1413,9 @@ void net_route_init(void)
 
 #if defined(CONFIG_NET_ROUTE_MCAST)
 	memset(route_mcast_entries, 0, sizeof(route_mcast_entries));
+#endif
+#if defined(CONFIG_NET_ROUTE_LPM)
+	route_lpm_init();
 #endif
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #endif
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
 #include <zephyr/net/udp.h>
 #include "ipv4.h"
 #include "ipv6.h"
@@ -25,6 +26,9 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #include "net_stats.h"
 #include "net_private.h"
 #include "tcp_internal.h"
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+#include "tcp_ca.h"
+#endif
 #include "pmtu.h"
 
 #define ACK_TIMEOUT_MS tcp_max_timeout_ms
@@ -73,6 +77,24 @@ static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
 
+#define TCP_HASH_MASK (CONFIG_NET_TCP_HASH_BUCKETS - 1)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_TCP_HASH_BUCKETS),
+	     "CONFIG_NET_TCP_HASH_BUCKETS must be a power of two");
+
+/* Connections with known endpoints are also indexed on them, so that the RX
+ * path finds the connection of a segment without walking tcp_conns under
+ * tcp_lock. Each bucket has its own lock: segments of flows in different
+ * buckets are looked up concurrently, and then only take the lock of their
+ * own connection.
+ */
+struct tcp_hash_bucket {
+	sys_slist_t conns;
+	struct k_spinlock lock;
+};
+
+static struct tcp_hash_bucket tcp_hash[CONFIG_NET_TCP_HASH_BUCKETS];
+
 K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
 				CONFIG_NET_MAX_CONTEXTS, 4);
 
@@ -274,6 +296,46 @@ static int tcp_endpoint_set(union tcp_endpoint *ep, struct net_pkt *pkt,
 	return ret;
 }
 
+static uint16_t tcp_hash_key(const union tcp_endpoint *local,
+			     const union tcp_endpoint *remote)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && remote->sa.sa_family == NET_AF_INET6) {
+		return net_conn_hash(0U, local->sin6.sin6_port, remote->sin6.sin6_port,
+				     remote->sin6.sin6_addr.s6_addr,
+				     sizeof(struct net_in6_addr)) & TCP_HASH_MASK;
+	}
+
+	return net_conn_hash(0U, local->sin.sin_port, remote->sin.sin_port,
+			     remote->sin.sin_addr.s4_addr,
+			     sizeof(struct net_in_addr)) & TCP_HASH_MASK;
+}
+
+static void tcp_conn_hash_del(struct tcp *conn)
+{
+	struct tcp_hash_bucket *bucket = &tcp_hash[conn->hash];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&bucket->lock);
+	(void)sys_slist_find_and_remove(&bucket->conns, &conn->hash_node);
+	k_spin_unlock(&bucket->lock, key);
+}
+
+/* To be called once the endpoints of the connection are set */
+static void tcp_conn_hash_add(struct tcp *conn)
+{
+	struct tcp_hash_bucket *bucket;
+	k_spinlock_key_t key;
+
+	tcp_conn_hash_del(conn);
+
+	conn->hash = tcp_hash_key(&conn->src, &conn->dst);
+	bucket = &tcp_hash[conn->hash];
+
+	key = k_spin_lock(&bucket->lock);
+	sys_slist_prepend(&bucket->conns, &conn->hash_node);
+	k_spin_unlock(&bucket->lock, key);
+}
+
 int net_tcp_endpoint_copy(struct net_context *ctx,
 			  struct net_sockaddr *local,
 			  struct net_sockaddr *peer,
@@ -495,112 +557,205 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-/* Implementation according to RFC6582 */
+static const struct tcp_ca_ops *tcp_ca_default;
+
+const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
+{
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
+
+	return NULL;
+}
+
+static void tcp_ca_default_init(void)
+{
+	tcp_ca_default = tcp_ca_find(CONFIG_NET_TCP_CA_DEFAULT,
+				     sizeof(CONFIG_NET_TCP_CA_DEFAULT) - 1);
+	if (tcp_ca_default == NULL) {
+		NET_WARN("Congestion control %s not available, using %s",
+			 CONFIG_NET_TCP_CA_DEFAULT, "newreno");
+		tcp_ca_default = tcp_ca_find("newreno", sizeof("newreno") - 1);
+	}
+}
 
-static void tcp_new_reno_log(struct tcp *conn, char *step)
+static void tcp_ca_conn_init(struct tcp *conn, struct tcp *parent)
 {
-	NET_DBG("[%p] ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
-		conn->ca.pending_fast_retransmit_bytes);
+	/* Initially set the congestion window at its max size, since only the MSS
+	 * is available as soon as the connection is established
+	 */
+	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.ops = parent != NULL ? parent->ca.ops : tcp_ca_default;
+	conn->ca.rtt_pending = false;
+	conn->ca.rtt_valid = false;
+	conn->ca.pending_fast_retransmit_bytes = 0;
 }
 
-static void tcp_new_reno_init(struct tcp *conn)
+static void tcp_ca_init(struct tcp *conn)
 {
 	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
 	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
 	conn->ca.pending_fast_retransmit_bytes = 0;
-	tcp_new_reno_log(conn, "init");
+	conn->ca.ops->init(conn);
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+/* Time one segment per round trip. As in Karn's algorithm, the measurement
+ * is abandoned if the segment may be retransmitted.
+ */
+static void tcp_ca_rtt_start(struct tcp *conn, uint32_t seq_end)
 {
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-		/* Account for the lost segments */
-		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
-		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
-		tcp_new_reno_log(conn, "fast_retransmit");
+	if (!conn->ca.rtt_pending) {
+		conn->ca.rtt_pending = true;
+		conn->ca.rtt_seq = seq_end;
+		conn->ca.rtt_start = k_uptime_get_32();
 	}
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+static int32_t tcp_ca_rtt_sample(struct tcp *conn, uint32_t ack)
 {
-	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-	conn->ca.cwnd = conn_mss(conn);
-	tcp_new_reno_log(conn, "timeout");
-}
+	uint32_t rtt;
 
-/* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
-{
-	int32_t new_win = conn->ca.cwnd;
+	if (!conn->ca.rtt_pending || net_tcp_seq_cmp(ack, conn->ca.rtt_seq) < 0) {
+		return -1;
+	}
+
+	rtt = k_uptime_get_32() - conn->ca.rtt_start;
+	conn->ca.rtt_pending = false;
+
+	if (conn->ca.rtt_valid) {
+		conn->ca.srtt = (conn->ca.srtt * 7 + rtt) / 8;
+		conn->ca.min_rtt = MIN(conn->ca.min_rtt, rtt);
+	} else {
+		conn->ca.srtt = rtt;
+		conn->ca.min_rtt = rtt;
+		conn->ca.rtt_valid = true;
+	}
 
-	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	tcp_new_reno_log(conn, "dup_ack");
+	return (int32_t)rtt;
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+	conn->ca.rtt_pending = false;
 
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
-		} else {
-			/* Implement a div_ceil	to avoid rounding to 0 */
-			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
-		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	} else {
-		/* Check if it is still in fast recovery mode */
-		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
-			conn->ca.pending_fast_retransmit_bytes = 0;
-			conn->ca.cwnd = conn->ca.ssthresh;
-		} else {
-			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
-		}
+	if (!tcp_ca_in_recovery(conn)) {
+		conn->ca.ops->fast_retransmit(conn);
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca.rtt_pending = false;
+	conn->ca.ops->timeout(conn);
 }
 
-static void tcp_ca_fast_retransmit(struct tcp *conn)
+static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	if (conn->ca.ops->dup_ack != NULL) {
+		conn->ca.ops->dup_ack(conn);
+	}
 }
 
-static void tcp_ca_timeout(struct tcp *conn)
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t ack, uint32_t acked_len)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca.ops->pkts_acked(conn, acked_len, tcp_ca_rtt_sample(conn, ack));
 }
 
-static void tcp_ca_dup_ack(struct tcp *conn)
+static int set_tcp_congestion(struct tcp *conn, const void *value, uint32_t len)
 {
-	tcp_new_reno_dup_ack(conn);
+	const char *name = value;
+	const struct tcp_ca_ops *ops;
+	size_t name_len = 0;
+
+	/* Like on Linux, the name does not need to be zero terminated */
+	while (name_len < len && name[name_len] != '\0') {
+		name_len++;
+	}
+
+	ops = tcp_ca_find(name, name_len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca.ops) {
+		return 0;
+	}
+
+	conn->ca.ops = ops;
+
+	/* The windows are kept, the new algorithm starts from them */
+	if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+		conn->ca.pending_fast_retransmit_bytes = 0;
+		conn->ca.ops->init(conn);
+	}
+
+	return 0;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	size_t name_len = strlen(conn->ca.ops->name);
+
+	if (*len <= name_len) {
+		return -EINVAL;
+	}
+
+	memcpy(value, conn->ca.ops->name, name_len + 1);
+	*len = name_len + 1;
+
+	return 0;
 }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static int get_tcp_info(struct tcp *conn, void *value, uint32_t *len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	struct zsock_tcp_info *info = value;
+
+	if (*len < sizeof(*info)) {
+		return -EINVAL;
+	}
+
+	info->cwnd = conn->ca.cwnd;
+	info->ssthresh = conn->ca.ssthresh;
+	info->srtt_ms = conn->ca.rtt_valid ? conn->ca.srtt : 0;
+	info->min_rtt_ms = conn->ca.rtt_valid ? conn->ca.min_rtt : 0;
+	*len = sizeof(*info);
+
+	return 0;
 }
 #else
 
+static void tcp_ca_default_init(void) { }
+
+static void tcp_ca_conn_init(struct tcp *conn, struct tcp *parent) { }
+
 static void tcp_ca_init(struct tcp *conn) { }
 
+static void tcp_ca_rtt_start(struct tcp *conn, uint32_t seq_end) { }
+
 static void tcp_ca_fast_retransmit(struct tcp *conn) { }
 
 static void tcp_ca_timeout(struct tcp *conn) { }
 
 static void tcp_ca_dup_ack(struct tcp *conn) { }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t ack, uint32_t acked_len) { }
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, uint32_t len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_info(struct tcp *conn, void *value, uint32_t *len)
+{
+	return -ENOPROTOOPT;
+}
 
 #endif
 
@@ -829,6 +984,8 @@ static void tcp_conn_release(struct k_work *work)
 	struct tcp *conn = CONTAINER_OF(work, struct tcp, conn_release);
 	struct net_pkt *pkt;
 
+	tcp_conn_hash_del(conn);
+
 #if defined(CONFIG_NET_TEST)
 	if (conn->test_closed_cb != NULL) {
 		conn->test_closed_cb(conn, conn->test_user_data);
@@ -1157,6 +1314,35 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_cnt = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+						     NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_cnt; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					net_ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					net_ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1346,6 +1532,156 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* NOP, NOP, kind, length and the blocks */
+#define TCP_SACK_OPTS_MAX_LEN (4 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE)
+
+static bool tcp_sack_perm_send(struct tcp *conn, uint8_t flags)
+{
+	/* Offer SACK in our SYN, accept it in our SYN-ACK if it was offered */
+	return (flags & SYN) && (!(flags & ACK) || conn->sack_ok);
+}
+
+/* Get the next run of contiguous data in the receive queue */
+static bool tcp_sack_block_next(struct net_buf **buf, struct tcp_sack_block *block)
+{
+	if (*buf == NULL) {
+		return false;
+	}
+
+	block->start = tcp_get_seq(*buf);
+	block->end = block->start;
+
+	while (*buf != NULL && tcp_get_seq(*buf) == block->end) {
+		block->end += (*buf)->len;
+		*buf = (*buf)->frags;
+	}
+
+	return true;
+}
+
+/* Report the out-of-order data in the receive queue as SACK blocks */
+static size_t tcp_sack_blocks_get(struct tcp *conn, uint8_t flags,
+				  struct tcp_sack_block *blocks)
+{
+	struct tcp_sack_block block;
+	struct net_buf *buf;
+	size_t cnt = 0;
+
+	if (!conn->sack_ok || (flags & (SYN | ACK)) != ACK) {
+		return 0;
+	}
+
+	/* RFC 2018 chapter 4: the first block reports the most recently
+	 * received data, the others follow in sequence order.
+	 */
+	buf = conn->queue_recv_data;
+	while (tcp_sack_block_next(&buf, &block)) {
+		if (net_tcp_seq_cmp(conn->sack_last_seq, block.start) >= 0 &&
+		    net_tcp_seq_cmp(conn->sack_last_seq, block.end) < 0) {
+			blocks[cnt++] = block;
+			break;
+		}
+	}
+
+	buf = conn->queue_recv_data;
+	while (cnt < NET_TCP_SACK_MAX_BLOCKS && tcp_sack_block_next(&buf, &block)) {
+		if (cnt > 0 && block.start == blocks[0].start) {
+			continue;
+		}
+
+		blocks[cnt++] = block;
+	}
+
+	return cnt;
+}
+
+static size_t tcp_sack_opts_build(struct tcp *conn, uint8_t flags, uint8_t *opts)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	size_t cnt;
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+
+	if (tcp_sack_perm_send(conn, flags)) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return 4;
+	}
+
+	cnt = tcp_sack_blocks_get(conn, flags, blocks);
+	if (cnt == 0) {
+		return 0;
+	}
+
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = 2 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (size_t i = 0; i < cnt; i++) {
+		uint8_t *block = &opts[4 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+		UNALIGNED_PUT(net_htonl(blocks[i].start), (uint32_t *)block);
+		UNALIGNED_PUT(net_htonl(blocks[i].end), (uint32_t *)(block + 4));
+	}
+
+	return 4 + cnt * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static size_t tcp_sack_opts_len(struct tcp *conn, uint8_t flags)
+{
+	uint8_t opts[TCP_SACK_OPTS_MAX_LEN];
+
+	return tcp_sack_opts_build(conn, flags, opts);
+}
+
+static int tcp_sack_opts_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	uint8_t opts[TCP_SACK_OPTS_MAX_LEN];
+	size_t len;
+
+	len = tcp_sack_opts_build(conn, flags, opts);
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, opts, len);
+}
+#else
+static size_t tcp_sack_opts_len(struct tcp *conn, uint8_t flags)
+{
+	return 0;
+}
+
+static int tcp_sack_opts_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags)
+{
+	return 0;
+}
+
+#endif
+
+/* Length of the TCP options sent in a segment, a multiple of 4 */
+static size_t tcp_out_options_len(struct tcp *conn, uint8_t flags)
+{
+	size_t len = tcp_sack_opts_len(conn, flags);
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+	return len;
+}
+
+/* Data size of a segment, the MSS less the options sent with the data, like
+ * the SACK blocks reporting out of order data, so that segments fit the MTU.
+ */
+static int tcp_data_mss(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_out_options_len(conn, PSH | ACK);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1361,11 +1697,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_sport));
 	UNALIGNED_PUT(conn->dst.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_dport));
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + tcp_out_options_len(conn, flags) / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(net_htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
@@ -1557,14 +1889,10 @@ err:
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	size_t alloc_len = sizeof(struct tcphdr) + tcp_out_options_len(conn, flags);
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
-
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1574,6 +1902,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 		data->buffer = NULL;
 	}
 
@@ -1597,6 +1926,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_opts_add(conn, pkt, flags);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1814,47 +2149,111 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
-static int tcp_send_data(struct tcp *conn)
+#if defined(CONFIG_NET_GSO)
+/* Largest amount of data sent in one packet, which is segmented later on
+ * by the Ethernet layer or by the device.
+ */
+static int tcp_gso_max_len(struct tcp *conn)
+{
+	int mss = tcp_data_mss(conn);
+	int max_len;
+
+	if (conn->iface == NULL ||
+	    net_if_l2(conn->iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		return mss;
+	}
+
+	/* Locally delivered packets are not segmented */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && conn->dst.sa.sa_family == NET_AF_INET &&
+	    (net_ipv4_is_addr_loopback(&conn->dst.sin.sin_addr) ||
+	     net_ipv4_is_my_addr(&conn->dst.sin.sin_addr))) {
+		return mss;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->dst.sa.sa_family == NET_AF_INET6 &&
+	    (net_ipv6_is_addr_loopback(&conn->dst.sin6.sin6_addr) ||
+	     net_ipv6_is_my_addr(&conn->dst.sin6.sin6_addr))) {
+		return mss;
+	}
+
+	/* Leave room for the IPv6 header and a TCP header with 40 bytes of
+	 * options.
+	 */
+	max_len = CONFIG_NET_GSO_MAX_SIZE - NET_IPV6H_LEN - NET_TCPH_LEN - 40;
+
+	return MAX(mss, max_len - max_len % mss);
+}
+
+static struct net_pkt *tcp_data_pkt_alloc(struct tcp *conn, int len)
 {
-	int ret = 0;
-	int len;
 	struct net_pkt *pkt;
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
-	if (len < 0) {
-		ret = len;
-		goto out;
+	if (len <= tcp_data_mss(conn)) {
+		return tcp_pkt_alloc(conn, len);
 	}
-	if (len == 0) {
-		NET_DBG("[%p] no data to send", conn);
-		ret = -ENODATA;
-		goto out;
+
+	/* The buffer of a GSO packet is not limited by the MTU */
+	pkt = tcp_pkt_alloc(conn, 0);
+	if (!pkt) {
+		return NULL;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
+	if (net_pkt_alloc_buffer_raw(pkt, len, TCP_PKT_ALLOC_TIMEOUT) < 0) {
+		tcp_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_set_gso_size(pkt, tcp_data_mss(conn));
+
+	return pkt;
+}
+#else
+static int tcp_gso_max_len(struct tcp *conn)
+{
+	return tcp_data_mss(conn);
+}
+
+static struct net_pkt *tcp_data_pkt_alloc(struct tcp *conn, int len)
+{
+	return tcp_pkt_alloc(conn, len);
+}
+#endif /* CONFIG_NET_GSO */
+
+/* Send len bytes of the send_data starting at offset from the first
+ * unacknowledged byte. More than one MSS is sent as a GSO packet.
+ */
+static int tcp_send_segment(struct tcp *conn, int offset, int len, bool resend)
+{
+	int segs = DIV_ROUND_UP(len, tcp_data_mss(conn));
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_data_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("[%p] packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_pkt_peek(pkt, &conn->send_data, conn->unacked_len, len);
+	ret = tcp_pkt_peek(pkt, &conn->send_data, offset, len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
 	if (ret == 0) {
-		conn->unacked_len += len;
-
-		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		if (resend) {
 			net_stats_update_tcp_resent(conn->iface, len);
-			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
 			net_stats_update_tcp_sent(conn->iface, len);
-			net_stats_update_tcp_seg_sent(conn->iface);
+		}
+
+		while (segs-- > 0) {
+			if (resend) {
+				net_stats_update_tcp_seg_rexmit(conn->iface);
+			} else {
+				net_stats_update_tcp_seg_sent(conn->iface);
+			}
 		}
 	}
 
@@ -1864,6 +2263,308 @@ static int tcp_send_data(struct tcp *conn)
 	 */
 	tcp_pkt_unref(pkt);
 
+	return ret;
+}
+
+#ifdef CONFIG_NET_TCP_SACK
+
+#define TCP_SACK_SEG(_conn, _i) \
+	(&(_conn)->sack.segs[((_conn)->sack.head + (_i)) % CONFIG_NET_TCP_SACK_SEGMENTS])
+
+static bool tcp_sack_active(struct tcp *conn)
+{
+	return conn->sack_ok;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.head = 0;
+	conn->sack.count = 0;
+	conn->sack.in_recovery = false;
+#ifdef CONFIG_NET_TCP_RACK
+	conn->sack.rack_xmit_time = k_uptime_get_32();
+	conn->sack.rack_end_seq = conn->seq;
+	conn->sack.rack_rtt = 0;
+#endif
+}
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_ok = conn->recv_options.sack_perm_found;
+	tcp_sack_reset(conn);
+
+	NET_DBG("[%p] SACK %s", conn, conn->sack_ok ? "permitted" : "not permitted");
+}
+
+/* Record a segment sent at the end of the unacknowledged data */
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, int len, bool resend)
+{
+	struct tcp_sack_seg *seg;
+
+	if (!conn->sack_ok || conn->sack.count == CONFIG_NET_TCP_SACK_SEGMENTS) {
+		return;
+	}
+
+	seg = TCP_SACK_SEG(conn, conn->sack.count);
+	seg->seq = seq;
+	seg->len = len;
+	seg->xmit_time = k_uptime_get_32();
+	seg->flags = resend ? TCP_SACK_SEG_REXMIT : 0;
+
+	conn->sack.count++;
+}
+
+#ifdef CONFIG_NET_TCP_RACK
+/* RFC 8985 RACK_sent_after(): the send times have a resolution of one
+ * millisecond, so the segments sent in the same tick are ordered by their
+ * sequence numbers.
+ */
+static bool tcp_rack_sent_after(uint32_t t1, uint32_t seq1, uint32_t t2, uint32_t seq2)
+{
+	int32_t diff = (int32_t)(t1 - t2);
+
+	return diff > 0 || (diff == 0 && net_tcp_seq_cmp(seq1, seq2) > 0);
+}
+
+/* RFC 8985 chapter 6.2, step 2 */
+static void tcp_rack_update(struct tcp *conn, struct tcp_sack_seg *seg, uint32_t now)
+{
+	uint32_t rtt = now - seg->xmit_time;
+
+	if (!(seg->flags & TCP_SACK_SEG_REXMIT)) {
+		if (conn->sack.min_rtt == 0 || rtt < conn->sack.min_rtt) {
+			conn->sack.min_rtt = MAX(rtt, 1);
+		}
+	} else if (rtt < conn->sack.min_rtt) {
+		/* Likely the ACK of the original transmission */
+		return;
+	}
+
+	if (tcp_rack_sent_after(seg->xmit_time, seg->seq + seg->len,
+				conn->sack.rack_xmit_time, conn->sack.rack_end_seq)) {
+		conn->sack.rack_xmit_time = seg->xmit_time;
+		conn->sack.rack_end_seq = seg->seq + seg->len;
+		conn->sack.rack_rtt = rtt;
+	}
+}
+
+static bool tcp_sack_seg_lost(struct tcp *conn, int idx, uint32_t now)
+{
+	struct tcp_sack_seg *seg = TCP_SACK_SEG(conn, idx);
+	/* At least one tick, or any segment would be lost as soon as a later
+	 * one is delivered with a sub-millisecond RTT.
+	 */
+	uint32_t reo_wnd = MAX(conn->sack.min_rtt / 4, 1);
+
+	if (seg->flags & TCP_SACK_SEG_SACKED) {
+		return false;
+	}
+
+	/* Only a segment sent before the last delivered one can be lost */
+	if (!tcp_rack_sent_after(conn->sack.rack_xmit_time, conn->sack.rack_end_seq,
+				 seg->xmit_time, seg->seq + seg->len)) {
+		return false;
+	}
+
+	return (int32_t)(now - (seg->xmit_time + conn->sack.rack_rtt + reo_wnd)) >= 0;
+}
+#else
+static void tcp_rack_update(struct tcp *conn, struct tcp_sack_seg *seg, uint32_t now)
+{
+}
+
+/* RFC 6675 IsLost(), counted in segments */
+static bool tcp_sack_seg_lost(struct tcp *conn, int idx, uint32_t now)
+{
+	struct tcp_sack_seg *seg = TCP_SACK_SEG(conn, idx);
+	int sacked = 0;
+
+	ARG_UNUSED(now);
+
+	if (seg->flags & (TCP_SACK_SEG_SACKED | TCP_SACK_SEG_REXMIT)) {
+		return false;
+	}
+
+	for (int i = idx + 1; i < conn->sack.count; i++) {
+		if (TCP_SACK_SEG(conn, i)->flags & TCP_SACK_SEG_SACKED) {
+			sacked++;
+		}
+	}
+
+	return sacked >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD;
+}
+#endif
+
+static bool tcp_sack_seg_in_block(struct tcp_sack_seg *seg, struct tcp_sack_block *block)
+{
+	return net_tcp_seq_cmp(seg->seq, block->start) >= 0 &&
+	       net_tcp_seq_cmp(seg->seq + seg->len, block->end) <= 0;
+}
+
+/* Mark the segments delivered by the ACK and the SACK blocks it carries */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_options *opts = &conn->recv_options;
+	uint32_t now = k_uptime_get_32();
+
+	if (!conn->sack_ok) {
+		return;
+	}
+
+	for (int i = 0; i < conn->sack.count; i++) {
+		struct tcp_sack_seg *seg = TCP_SACK_SEG(conn, i);
+		bool delivered = net_tcp_seq_cmp(seg->seq + seg->len, ack) <= 0;
+
+		if (seg->flags & TCP_SACK_SEG_SACKED) {
+			continue;
+		}
+
+		for (int j = 0; !delivered && j < opts->sack_cnt; j++) {
+			if (tcp_sack_seg_in_block(seg, &opts->sack[j])) {
+				seg->flags |= TCP_SACK_SEG_SACKED;
+				delivered = true;
+			}
+		}
+
+		if (delivered) {
+			tcp_rack_update(conn, seg, now);
+		}
+	}
+}
+
+/* Drop the segments covered by the cumulative ACK */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	while (conn->sack.count > 0) {
+		struct tcp_sack_seg *seg = TCP_SACK_SEG(conn, 0);
+
+		if (net_tcp_seq_cmp(seg->seq + seg->len, conn->seq) > 0) {
+			if (net_tcp_seq_cmp(seg->seq, conn->seq) < 0) {
+				seg->len -= conn->seq - seg->seq;
+				seg->seq = conn->seq;
+			}
+
+			break;
+		}
+
+		conn->sack.head = (conn->sack.head + 1) % CONFIG_NET_TCP_SACK_SEGMENTS;
+		conn->sack.count--;
+	}
+
+	if (conn->sack.in_recovery &&
+	    net_tcp_seq_cmp(conn->seq, conn->sack.recovery_point) >= 0) {
+		conn->sack.in_recovery = false;
+	}
+}
+
+/* Retransmit the first lost segment, one segment per received ACK */
+static void tcp_sack_recover(struct tcp *conn)
+{
+	uint32_t now = k_uptime_get_32();
+	int mss = tcp_data_mss(conn);
+	int ret;
+
+	if (!conn->sack_ok || conn->data_mode != TCP_DATA_MODE_SEND) {
+		return;
+	}
+
+	for (int i = 0; i < conn->sack.count; i++) {
+		struct tcp_sack_seg *seg = TCP_SACK_SEG(conn, i);
+
+		if (!tcp_sack_seg_lost(conn, i, now)) {
+			continue;
+		}
+
+		if (!conn->sack.in_recovery) {
+			conn->sack.in_recovery = true;
+			conn->sack.recovery_point = conn->seq + conn->unacked_len;
+			net_stats_update_tcp_fast_rexmit(conn->iface);
+			tcp_ca_fast_retransmit(conn);
+		}
+
+		NET_DBG("[%p] SACK retransmit seq %u len %u", conn, seg->seq, seg->len);
+
+		/* More SACK blocks may be sent now than when the segment was
+		 * first sent, leaving less room for its data.
+		 */
+		ret = 0;
+		for (int off = 0; off < seg->len && ret == 0; off += mss) {
+			ret = tcp_send_segment(conn, seg->seq - conn->seq + off,
+					       MIN(mss, seg->len - off), true);
+		}
+
+		if (ret == 0) {
+			seg->flags |= TCP_SACK_SEG_REXMIT;
+			seg->xmit_time = now;
+		}
+
+		break;
+	}
+}
+#else
+static bool tcp_sack_active(struct tcp *conn)
+{
+	return false;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+}
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+}
+
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, int len, bool resend)
+{
+}
+
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+}
+
+static void tcp_sack_acked(struct tcp *conn)
+{
+}
+
+static void tcp_sack_recover(struct tcp *conn)
+{
+}
+#endif
+
+static int tcp_send_data(struct tcp *conn)
+{
+	bool resend = conn->data_mode == TCP_DATA_MODE_RESEND;
+	int mss = tcp_data_mss(conn);
+	int ret = 0;
+	int len;
+
+	len = MIN(tcp_unsent_len(conn), resend ? mss : tcp_gso_max_len(conn));
+	if (len < 0) {
+		ret = len;
+		goto out;
+	}
+	if (len == 0) {
+		NET_DBG("[%p] no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	ret = tcp_send_segment(conn, conn->unacked_len, len, resend);
+	if (ret == 0) {
+		if (!resend) {
+			tcp_ca_rtt_start(conn, conn->seq + conn->unacked_len + len);
+		}
+
+		/* The scoreboard tracks the segments as sent on the wire */
+		for (int sent = 0; sent < len; sent += mss) {
+			tcp_sack_sent(conn, conn->seq + conn->unacked_len + sent,
+				      MIN(mss, len - sent), resend);
+		}
+
+		conn->unacked_len += len;
+	}
+
 	conn_send_data_dump(conn);
 
  out:
@@ -1961,6 +2662,8 @@ static void tcp_resend_data(struct k_work *work)
 		break;
 	case TCP_ESTABLISHED:
 	case TCP_CLOSE_WAIT:
+		net_stats_update_tcp_rto(conn->iface);
+
 		if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE) &&
 		    (conn->send_data_retries == 0)) {
 			tcp_ca_timeout(conn);
@@ -1971,6 +2674,7 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_reset(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2166,6 +2870,21 @@ static void tcp_conn_ref(struct tcp *conn)
 	NET_DBG("[%p] ref_count: %d", conn, ref_count);
 }
 
+/* Take a reference unless the connection is already being released */
+static bool tcp_conn_try_ref(struct tcp *conn)
+{
+	atomic_val_t ref_count;
+
+	do {
+		ref_count = atomic_get(&conn->ref_count);
+		if (ref_count == 0) {
+			return false;
+		}
+	} while (!atomic_cas(&conn->ref_count, ref_count, ref_count + 1));
+
+	return true;
+}
+
 static struct tcp *tcp_conn_alloc(void)
 {
 	struct tcp *conn = NULL;
@@ -2199,12 +2918,7 @@ static struct tcp *tcp_conn_alloc(void)
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
-#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	/* Initially set the congestion window at its max size, since only the MSS
-	 * is available as soon as the connection is established
-	 */
-	conn->ca.cwnd = UINT16_MAX;
-#endif
+	tcp_ca_conn_init(conn, NULL);
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -2252,42 +2966,41 @@ int net_tcp_get(struct net_context *context)
 	return ret;
 }
 
-static bool tcp_endpoint_cmp(union tcp_endpoint *ep, struct net_pkt *pkt,
-			     enum pkt_addr which)
+/* Find the connection of a received segment. The connection is returned with
+ * a reference held, to be released with tcp_conn_unref().
+ */
+static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 {
-	union tcp_endpoint ep_tmp;
+	union tcp_endpoint local;
+	union tcp_endpoint remote;
+	struct tcp_hash_bucket *bucket;
+	struct tcp *found = NULL;
+	struct tcp *conn;
+	k_spinlock_key_t key;
+	size_t len;
 
-	if (tcp_endpoint_set(&ep_tmp, pkt, which) < 0) {
-		return false;
+	if (tcp_endpoint_set(&local, pkt, TCP_EP_DST) < 0 ||
+	    tcp_endpoint_set(&remote, pkt, TCP_EP_SRC) < 0) {
+		return NULL;
 	}
 
-	return !memcmp(ep, &ep_tmp, tcp_endpoint_len(ep->sa.sa_family));
-}
+	len = tcp_endpoint_len(local.sa.sa_family);
+	bucket = &tcp_hash[tcp_hash_key(&local, &remote)];
 
-static bool tcp_conn_cmp(struct tcp *conn, struct net_pkt *pkt)
-{
-	return tcp_endpoint_cmp(&conn->src, pkt, TCP_EP_DST) &&
-		tcp_endpoint_cmp(&conn->dst, pkt, TCP_EP_SRC);
-}
-
-static struct tcp *tcp_conn_search(struct net_pkt *pkt)
-{
-	bool found = false;
-	struct tcp *conn;
-	struct tcp *tmp;
-
-	k_mutex_lock(&tcp_lock, K_FOREVER);
+	key = k_spin_lock(&bucket->lock);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&tcp_conns, conn, tmp, next) {
-		found = tcp_conn_cmp(conn, pkt);
-		if (found) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&bucket->conns, conn, hash_node) {
+		if (memcmp(&conn->src, &local, len) == 0 &&
+		    memcmp(&conn->dst, &remote, len) == 0 &&
+		    tcp_conn_try_ref(conn)) {
+			found = conn;
 			break;
 		}
 	}
 
-	k_mutex_unlock(&tcp_lock);
+	k_spin_unlock(&bucket->lock, key);
 
-	return found ? conn : NULL;
+	return found;
 }
 
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
@@ -2307,7 +3020,9 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 
 	conn = tcp_conn_search(pkt);
 	if (conn) {
-		goto in;
+		verdict = tcp_in(conn, pkt);
+		tcp_conn_unref(conn);
+		goto out;
 	}
 
 	th = th_get(pkt);
@@ -2330,6 +3045,7 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		}
 
 		conn->accepted_conn = conn_old;
+		tcp_ca_conn_init(conn, conn_old);
 	}
 in:
 	if (conn) {
@@ -2485,6 +3201,8 @@ static struct tcp *tcp_conn_new(struct net_pkt *pkt)
 		goto err;
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("[%p] src: %s, dst: %s", conn,
 		net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr),
@@ -2796,6 +3514,9 @@ static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 	if (inserted) {
 		/* We need to keep the received data but free the pkt */
 		pkt->buffer = NULL;
+#ifdef CONFIG_NET_TCP_SACK
+		conn->sack_last_seq = seq_start;
+#endif
 
 		if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
 			k_work_reschedule_for_queue(
@@ -2808,6 +3529,7 @@ static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 					  size_t *len, bool psh, bool fin)
 {
+	int segs = MAX(net_pkt_gro_segs(pkt), 1);
 	enum net_verdict ret;
 
 	if (*len == 0) {
@@ -2816,7 +3538,10 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 
 	ret = tcp_data_get(conn, pkt, len);
 
-	net_stats_update_tcp_seg_recv(conn->iface);
+	for (int i = 0; i < segs; i++) {
+		net_stats_update_tcp_seg_recv(conn->iface);
+	}
+
 	conn_ack(conn, *len);
 
 	/* In case FIN was received, don't send ACK just yet, FIN,ACK will be
@@ -2827,9 +3552,10 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 	}
 
 	/* Delay ACK response in case of small window or missing PSH,
-	 * as described in RFC 813.
+	 * as described in RFC 813. Several segments merged by GRO are
+	 * acknowledged at once, as RFC 1122 asks for every second segment.
 	 */
-	if (tcp_short_window(conn) || !psh) {
+	if (tcp_short_window(conn) || (!psh && segs < 2)) {
 		k_work_schedule_for_queue(&tcp_work_q, &conn->ack_timer,
 					  ACK_DELAY);
 	} else {
@@ -2999,6 +3725,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	/* SACK options only describe the segment carrying them */
+	conn->recv_options.sack_cnt = 0;
+	conn->recv_options.sack_perm_found = false;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("[%p] DROP: Invalid TCP option list", conn);
@@ -3094,6 +3826,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn->isn_peer = th_seq(th);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
@@ -3225,6 +3958,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			net_context_set_state(conn->context,
 					      NET_CONTEXT_CONNECTED);
 			tcp_ca_init(conn);
+			tcp_sack_negotiate(conn);
 			tcp_out(conn, ACK);
 
 			/* The connection semaphore is released *after*
@@ -3269,9 +4003,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				conn->dup_ack_cnt = 0;
 			}
 
-			/* Only do fast retransmit when not already in a resend state */
+			/* Only do fast retransmit when not already in a resend state,
+			 * with SACK the scoreboard tells what to retransmit.
+			 */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+			    !tcp_sack_active(conn)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
 
@@ -3282,6 +4019,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
 
+				net_stats_update_tcp_fast_rexmit(conn->iface);
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
@@ -3294,6 +4032,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			   "conn: %p, Missing a subscription "
 				"of the send_data queue timer", conn);
 
+		tcp_sack_update(conn, th_ack(th));
+
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) > 0) {
 			uint32_t len_acked = th_ack(th) - conn->seq;
 
@@ -3316,7 +4056,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* New segment, reset duplicate ack counter */
 			conn->dup_ack_cnt = 0;
 #endif
-			tcp_ca_pkts_acked(conn, len_acked);
+			tcp_ca_pkts_acked(conn, th_ack(th), len_acked);
 
 			conn->send_data_total -= len_acked;
 			if (conn->unacked_len < len_acked) {
@@ -3330,6 +4070,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			}
 
 			conn_seq(conn, + len_acked);
+			tcp_sack_acked(conn);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
 			/* Receipt of an acknowledgment that covers a sequence number
@@ -3342,6 +4083,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 			if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 				conn->unacked_len = 0;
+				tcp_sack_reset(conn);
 				tcp_derive_rto(conn);
 			}
 			conn->data_mode = TCP_DATA_MODE_SEND;
@@ -3389,6 +4131,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			}
 		}
 
+		tcp_sack_recover(conn);
+
 		if (th_seq(th) == conn->ack) {
 			if (len > 0) {
 				bool psh;
@@ -4035,6 +4779,8 @@ int net_tcp_connect(struct net_context *context,
 		net_sprint_addr(conn->dst.sa.sa_family,
 				(const void *)&conn->dst.sin6.sin6_addr));
 
+	tcp_conn_hash_add(conn);
+
 	net_context_set_state(context, NET_CONTEXT_CONNECTING);
 
 	ret = net_conn_register(net_context_get_proto(context),
@@ -4217,7 +4963,9 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
+	/* The checksums of a GSO packet are computed per segment */
+	if ((net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) &&
+	    net_pkt_gso_size(pkt) == 0U) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4232,7 +4980,8 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == NET_AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
-	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	/* The segments merged by GRO were verified one by one */
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) && net_pkt_gro_segs(pkt) == 0U &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -4271,15 +5020,19 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 			conn = context->tcp;
 			tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 			tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+			tcp_conn_hash_add(conn);
 			/* Make an extra reference, the sanity check suite
 			 * will delete the connection explicitly
 			 */
 			tcp_conn_ref(conn);
+			/* Balanced by the unref below, like a searched one */
+			tcp_conn_ref(conn);
 		}
 
 		if (conn) {
 			conn->iface = pkt->iface;
 			verdict = tcp_in(conn, pkt);
+			tcp_conn_unref(conn);
 		}
 	}
 
@@ -4352,6 +5105,11 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 	static char buf[512];
 	enum net_verdict verdict = NET_DROP;
 
+	/* The sanity check suite holds its own reference to the connections */
+	if (conn != NULL) {
+		tcp_conn_unref(conn);
+	}
+
 	net_pkt_cursor_init(pkt);
 	net_pkt_set_overwrite(pkt, true);
 	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
@@ -4395,6 +5153,7 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 				conn = context->tcp;
 				tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 				tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+				tcp_conn_hash_add(conn);
 				conn->iface = pkt->iface;
 				tcp_conn_ref(conn);
 			}
@@ -4683,6 +5442,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4720,6 +5482,12 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
+	case TCP_OPT_INFO:
+		ret = get_tcp_info(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4861,6 +5629,8 @@ void net_tcp_init(void)
 		tcp_max_timeout_ms += tcp_max_timeout_ms >> 1;
 	}
 
+	tcp_ca_default_init();
+
 	k_thread_name_set(&tcp_work_q.thread, "tcp_work");
 	NET_DBG("Workq started. Thread ID: %p", &tcp_work_q.thread);
 }
@@ -0,0 +1,129 @@
+/** @file
+ * @brief TCP congestion control algorithms
+ *
+ * The algorithms register a struct tcp_ca_ops with TCP_CA_REGISTER().
+ * The TCP stack calls them with the connection lock held, and they
+ * update conn->ca.cwnd and conn->ca.ssthresh. An algorithm keeps its own
+ * state in conn->ca.priv, see tcp_ca_priv().
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __TCP_CA_H
+#define __TCP_CA_H
+
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+
+#include "tcp_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Longest name of a congestion control algorithm, without the terminating zero */
+#define TCP_CA_NAME_MAX 15
+
+struct tcp_ca_ops {
+	/** Name given to the TCP_CONGESTION socket option */
+	const char *name;
+
+	/** Connection established, or algorithm changed on an established
+	 * connection. The window values are already set.
+	 */
+	void (*init)(struct tcp *conn);
+
+	/** Loss detected by duplicate or selective ACKs, not called again
+	 * until the fast recovery is over.
+	 */
+	void (*fast_retransmit)(struct tcp *conn);
+
+	/** Retransmission timer expired */
+	void (*timeout)(struct tcp *conn);
+
+	/** Duplicate ACK received, optional */
+	void (*dup_ack)(struct tcp *conn);
+
+	/** New data acknowledged. The rtt is the round trip time in ms
+	 * measured on this ACK, or -1 if the ACK did not end a measurement.
+	 */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len, int32_t rtt);
+};
+
+#define TCP_CA_REGISTER(_name) \
+	static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, _name)
+
+/* Make sure the private state of an algorithm fits into struct tcp_ca */
+#define TCP_CA_PRIV_CHECK(_type) \
+	BUILD_ASSERT(sizeof(_type) <= TCP_CA_PRIV_SIZE, \
+		     #_type " does not fit into TCP_CA_PRIV_SIZE")
+
+const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len);
+
+static inline void *tcp_ca_priv(struct tcp *conn)
+{
+	return conn->ca.priv;
+}
+
+static inline void tcp_ca_set_cwnd(struct tcp *conn, uint32_t cwnd)
+{
+	conn->ca.cwnd = CLAMP(cwnd, conn_mss(conn), UINT16_MAX);
+}
+
+static inline bool tcp_ca_in_recovery(struct tcp *conn)
+{
+	return conn->ca.pending_fast_retransmit_bytes != 0;
+}
+
+static inline void tcp_ca_slow_start(struct tcp *conn, uint32_t acked_len)
+{
+	tcp_ca_set_cwnd(conn, conn->ca.cwnd + MIN(acked_len, conn_mss(conn)));
+}
+
+/* Enter fast recovery as in RFC 6582, the window is inflated by the three
+ * segments that left the network.
+ */
+static inline void tcp_ca_recovery_enter(struct tcp *conn, uint32_t ssthresh)
+{
+	conn->ca.ssthresh = CLAMP(ssthresh, conn_mss(conn) * 2, UINT16_MAX);
+	tcp_ca_set_cwnd(conn, conn_mss(conn) * 3 + conn->ca.ssthresh);
+	conn->ca.pending_fast_retransmit_bytes = MAX(conn->unacked_len, 1);
+}
+
+/* Deflate the window during fast recovery, and set it to ssthresh when
+ * all the data outstanding at the loss has been acknowledged.
+ * Returns false if the connection was not in fast recovery.
+ */
+static inline bool tcp_ca_recovery_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (!tcp_ca_in_recovery(conn)) {
+		return false;
+	}
+
+	if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+		conn->ca.pending_fast_retransmit_bytes = 0;
+		conn->ca.cwnd = conn->ca.ssthresh;
+	} else {
+		conn->ca.pending_fast_retransmit_bytes -= acked_len;
+		tcp_ca_set_cwnd(conn, conn->ca.cwnd > acked_len ?
+				conn->ca.cwnd - acked_len : 0);
+	}
+
+	return true;
+}
+
+#define tcp_ca_log(_conn, _step)					\
+	NET_DBG("[%p] %s %s, cwnd=%d, ssthres=%d, fast_pend=%i",	\
+		(_conn), (_conn)->ca.ops->name, (_step),		\
+		(_conn)->ca.cwnd, (_conn)->ca.ssthresh,			\
+		(_conn)->ca.pending_fast_retransmit_bytes)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TCP_CA_H */
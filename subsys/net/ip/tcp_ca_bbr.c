@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* BBR-lite, a delay based congestion control after the BBR algorithm.
+ *
+ * A round ends when the TCP stack gets a round trip time sample, the
+ * delivery rate of the round is the amount of data acknowledged during
+ * the round divided by its duration. The bottleneck bandwidth is the
+ * highest delivery rate of the last BBR_BW_ROUNDS rounds, and the
+ * bandwidth-delay product (BDP) its product with the minimum round trip
+ * time. As there is no pacing, the probing happens on the congestion
+ * window, which cycles around twice the BDP.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "tcp_ca.h"
+
+/* Rounds over which the maximum delivery rate is kept */
+#define BBR_BW_ROUNDS 4
+
+/* Rounds without a 25% bandwidth increase ending the startup */
+#define BBR_FULL_BW_ROUNDS 3
+
+#define BBR_MIN_CWND_SEGS 4
+
+enum bbr_mode {
+	BBR_STARTUP,
+	BBR_DRAIN,
+	BBR_PROBE_BW,
+};
+
+/* Congestion window gains of the probe cycle, in 1/4 units */
+static const uint8_t bbr_cwnd_gain[] = { 10, 6, 8, 8, 8, 8, 8, 8 };
+
+struct tcp_bbr {
+	uint32_t bw[BBR_BW_ROUNDS]; /* Delivery rates in bytes/s */
+	uint32_t full_bw;
+	uint32_t round_start;       /* in ms */
+	uint32_t round_delivered;   /* Bytes acknowledged in this round */
+	uint8_t round;
+	uint8_t full_bw_cnt;
+	uint8_t cycle_idx;
+	uint8_t mode;
+};
+
+TCP_CA_PRIV_CHECK(struct tcp_bbr);
+
+static uint32_t bbr_max_bw(struct tcp_bbr *bbr)
+{
+	uint32_t bw = 0;
+
+	for (int i = 0; i < BBR_BW_ROUNDS; i++) {
+		bw = MAX(bw, bbr->bw[i]);
+	}
+
+	return bw;
+}
+
+static uint32_t bbr_bdp(struct tcp *conn, struct tcp_bbr *bbr)
+{
+	/* A LAN can be faster than the millisecond resolution */
+	uint32_t min_rtt = MAX(conn->ca.min_rtt, 1);
+
+	return MIN((uint64_t)bbr_max_bw(bbr) * min_rtt / MSEC_PER_SEC, UINT16_MAX);
+}
+
+static void bbr_round_end(struct tcp *conn, struct tcp_bbr *bbr, uint32_t now)
+{
+	uint32_t elapsed = MAX(now - bbr->round_start, 1);
+	uint32_t bw;
+
+	bbr->round = (bbr->round + 1) % BBR_BW_ROUNDS;
+	bbr->bw[bbr->round] = (uint64_t)bbr->round_delivered * MSEC_PER_SEC / elapsed;
+	bbr->round_start = now;
+	bbr->round_delivered = 0;
+
+	bw = bbr_max_bw(bbr);
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		if (bw >= bbr->full_bw + bbr->full_bw / 4) {
+			bbr->full_bw = bw;
+			bbr->full_bw_cnt = 0;
+		} else if (++bbr->full_bw_cnt >= BBR_FULL_BW_ROUNDS) {
+			bbr->mode = BBR_DRAIN;
+			tcp_ca_log(conn, "drain");
+		}
+		break;
+	case BBR_DRAIN:
+		if (conn->unacked_len <= bbr_bdp(conn, bbr)) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0;
+			tcp_ca_log(conn, "probe_bw");
+		}
+		break;
+	case BBR_PROBE_BW:
+		bbr->cycle_idx = (bbr->cycle_idx + 1) % ARRAY_SIZE(bbr_cwnd_gain);
+		break;
+	}
+}
+
+static void bbr_init(struct tcp *conn)
+{
+	struct tcp_bbr *bbr = tcp_ca_priv(conn);
+
+	memset(bbr, 0, sizeof(*bbr));
+	bbr->mode = BBR_STARTUP;
+	bbr->round_start = k_uptime_get_32();
+	tcp_ca_log(conn, "init");
+}
+
+/* Losses are not a congestion signal for BBR, only keep the data in flight
+ * during the recovery and restore the window afterwards.
+ */
+static void bbr_fast_retransmit(struct tcp *conn)
+{
+	uint16_t prior_cwnd = conn->ca.cwnd;
+
+	tcp_ca_recovery_enter(conn, conn->unacked_len);
+	conn->ca.ssthresh = prior_cwnd;
+	tcp_ca_log(conn, "fast_retransmit");
+}
+
+static void bbr_timeout(struct tcp *conn)
+{
+	conn->ca.ssthresh = conn->ca.cwnd;
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_ca_log(conn, "timeout");
+}
+
+static void bbr_pkts_acked(struct tcp *conn, uint32_t acked_len, int32_t rtt)
+{
+	struct tcp_bbr *bbr = tcp_ca_priv(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t min_cwnd = conn_mss(conn) * BBR_MIN_CWND_SEGS;
+	uint32_t target;
+
+	bbr->round_delivered += acked_len;
+	if (rtt >= 0) {
+		bbr_round_end(conn, bbr, k_uptime_get_32());
+	}
+
+	if (tcp_ca_recovery_acked(conn, acked_len)) {
+		tcp_ca_log(conn, "pkts_acked");
+		return;
+	}
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		/* Double the window every round */
+		target = cwnd + acked_len;
+		break;
+	case BBR_DRAIN:
+		target = bbr_bdp(conn, bbr);
+		break;
+	default:
+		target = bbr_bdp(conn, bbr) * bbr_cwnd_gain[bbr->cycle_idx] / 4;
+		break;
+	}
+
+	target = MAX(target, min_cwnd);
+
+	/* Grow towards the target as data is delivered, for instance after a
+	 * timeout, but shrink at once.
+	 */
+	if (target > cwnd) {
+		tcp_ca_set_cwnd(conn, MIN(cwnd + acked_len, target));
+	} else {
+		tcp_ca_set_cwnd(conn, target);
+	}
+
+	tcp_ca_log(conn, "pkts_acked");
+}
+
+TCP_CA_REGISTER(tcp_ca_bbr) = {
+	.name = "bbr",
+	.init = bbr_init,
+	.fast_retransmit = bbr_fast_retransmit,
+	.timeout = bbr_timeout,
+	.pkts_acked = bbr_pkts_acked,
+};
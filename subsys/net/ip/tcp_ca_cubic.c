@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, implementation according to RFC 9438.
+ *
+ * The windows are in bytes and the times in milliseconds. With C = 0.4
+ * segments/s^3 the cubic function is:
+ *   W(t) = W_max + 4 * (t - K)^3 * mss / 10^10
+ *   K = cbrt((W_max - cwnd) * 10^10 / (4 * mss))
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "tcp_ca.h"
+
+/* beta_cubic = 0.7 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* alpha_cubic = 3 * (1 - beta_cubic) / (1 + beta_cubic) */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* 1 / C in ms^3 per segment, with C = 0.4 segments/s^3 */
+#define CUBIC_C_INV 2500000000ULL
+
+/* Beyond one minute the window is limited by UINT16_MAX anyway, this
+ * keeps the cube from overflowing.
+ */
+#define CUBIC_MAX_DELTA_MS 60000
+
+struct tcp_cubic {
+	uint32_t epoch_start; /* Start of the congestion avoidance epoch, in ms */
+	uint32_t w_max;       /* Window before the last reduction */
+	uint32_t w_est;       /* Window a Reno flow would have */
+	uint32_t k;           /* Time to grow back to w_max, in ms */
+	bool in_epoch;
+};
+
+TCP_CA_PRIV_CHECK(struct tcp_cubic);
+
+static uint32_t cubic_cbrt(uint64_t x)
+{
+	/* Largest cube root of a 64-bit value */
+	uint32_t hi = 2642245;
+	uint32_t lo = 0;
+
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo + 1) / 2;
+
+		if ((uint64_t)mid * mid * mid <= x) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+static uint32_t cubic_window(struct tcp *conn, struct tcp_cubic *cubic, uint32_t t)
+{
+	int64_t delta = CLAMP((int64_t)t - cubic->k, -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+	int64_t win = (int64_t)cubic->w_max +
+		      (delta * delta * delta * conn_mss(conn)) / (int64_t)CUBIC_C_INV;
+
+	return CLAMP(win, 0, UINT16_MAX);
+}
+
+/* Remember the window at the congestion event and return the new ssthresh */
+static uint32_t cubic_reduce(struct tcp *conn, struct tcp_cubic *cubic)
+{
+	/* Fast convergence, leave room to flows that started later */
+	if (conn->ca.cwnd < cubic->w_max) {
+		cubic->w_max = conn->ca.cwnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM) /
+			       (2 * CUBIC_BETA_DEN);
+	} else {
+		cubic->w_max = conn->ca.cwnd;
+	}
+
+	cubic->in_epoch = false;
+
+	return MAX(conn_mss(conn) * 2,
+		   conn->unacked_len * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+}
+
+static void cubic_init(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = tcp_ca_priv(conn);
+
+	memset(cubic, 0, sizeof(*cubic));
+	tcp_ca_log(conn, "init");
+}
+
+static void cubic_fast_retransmit(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = tcp_ca_priv(conn);
+
+	tcp_ca_recovery_enter(conn, cubic_reduce(conn, cubic));
+	tcp_ca_log(conn, "fast_retransmit");
+}
+
+static void cubic_timeout(struct tcp *conn)
+{
+	struct tcp_cubic *cubic = tcp_ca_priv(conn);
+
+	conn->ca.ssthresh = MIN(cubic_reduce(conn, cubic), UINT16_MAX);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_ca_log(conn, "timeout");
+}
+
+static void cubic_pkts_acked(struct tcp *conn, uint32_t acked_len, int32_t rtt)
+{
+	struct tcp_cubic *cubic = tcp_ca_priv(conn);
+	uint32_t now = k_uptime_get_32();
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+	uint32_t t;
+
+	ARG_UNUSED(rtt);
+
+	if (tcp_ca_recovery_acked(conn, acked_len)) {
+		tcp_ca_log(conn, "pkts_acked");
+		return;
+	}
+
+	if (cwnd < conn->ca.ssthresh) {
+		tcp_ca_slow_start(conn, acked_len);
+		tcp_ca_log(conn, "pkts_acked");
+		return;
+	}
+
+	if (!cubic->in_epoch) {
+		cubic->in_epoch = true;
+		cubic->epoch_start = now;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_cbrt((uint64_t)(cubic->w_max - cwnd) *
+					      CUBIC_C_INV / conn_mss(conn));
+		} else {
+			cubic->k = 0;
+			cubic->w_max = cwnd;
+		}
+	}
+
+	/* Aim at the window one round trip time from now */
+	t = now - cubic->epoch_start + (conn->ca.rtt_valid ? conn->ca.srtt : 0);
+	target = CLAMP(cubic_window(conn, cubic, t), cwnd, cwnd + cwnd / 2);
+
+	/* Never grow slower than a Reno flow would */
+	cubic->w_est = MIN(cubic->w_est + CUBIC_ALPHA_NUM * acked_len * conn_mss(conn) /
+			   (CUBIC_ALPHA_DEN * cwnd), UINT16_MAX);
+	target = MAX(target, cubic->w_est);
+
+	if (target > cwnd) {
+		tcp_ca_set_cwnd(conn, cwnd + MAX((target - cwnd) * acked_len / cwnd, 1));
+	}
+
+	tcp_ca_log(conn, "pkts_acked");
+}
+
+TCP_CA_REGISTER(tcp_ca_cubic) = {
+	.name = "cubic",
+	.init = cubic_init,
+	.fast_retransmit = cubic_fast_retransmit,
+	.timeout = cubic_timeout,
+	.pkts_acked = cubic_pkts_acked,
+};
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* NewReno congestion control, implementation according to RFC6582 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include "tcp_ca.h"
+
+static void tcp_new_reno_init(struct tcp *conn)
+{
+	tcp_ca_log(conn, "init");
+}
+
+static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+{
+	tcp_ca_recovery_enter(conn, conn->unacked_len / 2);
+	tcp_ca_log(conn, "fast_retransmit");
+}
+
+static void tcp_new_reno_timeout(struct tcp *conn)
+{
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_ca_log(conn, "timeout");
+}
+
+/* For every duplicate ack increment the cwnd by mss */
+static void tcp_new_reno_dup_ack(struct tcp *conn)
+{
+	tcp_ca_set_cwnd(conn, conn->ca.cwnd + conn_mss(conn));
+	tcp_ca_log(conn, "dup_ack");
+}
+
+static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len, int32_t rtt)
+{
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	ARG_UNUSED(rtt);
+
+	if (tcp_ca_recovery_acked(conn, acked_len)) {
+		/* Still in, or just out of fast recovery */
+	} else if (conn->ca.cwnd < conn->ca.ssthresh) {
+		tcp_ca_slow_start(conn, acked_len);
+	} else {
+		/* Implement a div_ceil	to avoid rounding to 0 */
+		tcp_ca_set_cwnd(conn, conn->ca.cwnd +
+				((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd);
+	}
+
+	tcp_ca_log(conn, "pkts_acked");
+}
+
+TCP_CA_REGISTER(tcp_ca_new_reno) = {
+	.name = "newreno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
@@ -229,26 +229,87 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Without timestamps, four SACK blocks fit in the 40 bytes of options */
+#define NET_TCP_SACK_MAX_BLOCKS 4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_cnt;
+	bool sack_perm_found : 1;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
+/* Room for the private state of the congestion control algorithm */
+#define TCP_CA_PRIV_SIZE 32
+
+struct tcp_ca_ops;
+
+struct tcp_ca {
+	const struct tcp_ca_ops *ops;
+	uint32_t priv[TCP_CA_PRIV_SIZE / sizeof(uint32_t)];
+	uint32_t rtt_seq;   /* ACK number ending the timed segment */
+	uint32_t rtt_start; /* Sent time of the timed segment, in ms */
+	uint32_t srtt;      /* Smoothed round trip time, in ms */
+	uint32_t min_rtt;   /* in ms */
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+	bool rtt_pending : 1; /* A segment is being timed */
+	bool rtt_valid : 1;   /* srtt and min_rtt hold a measurement */
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+
+enum tcp_sack_seg_flags {
+	TCP_SACK_SEG_SACKED = BIT(0),
+	TCP_SACK_SEG_REXMIT = BIT(1),
+};
+
+/* A segment sent but not acknowledged yet */
+struct tcp_sack_seg {
+	uint32_t seq;
+	uint32_t xmit_time; /* in ms */
+	uint16_t len;
+	uint8_t flags;
+};
+
+/* Scoreboard of the sent segments, oldest first */
+struct tcp_sack_scoreboard {
+	struct tcp_sack_seg segs[CONFIG_NET_TCP_SACK_SEGMENTS];
+	uint32_t recovery_point;
+#ifdef CONFIG_NET_TCP_RACK
+	uint32_t rack_xmit_time; /* Sent time of the last delivered segment */
+	uint32_t rack_end_seq; /* and its end sequence number */
+	uint32_t rack_rtt;
+	uint32_t min_rtt;
+#endif
+	uint8_t head;
+	uint8_t count;
+	bool in_recovery : 1;
 };
 #endif
 
@@ -257,6 +318,7 @@ typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
 	sys_snode_t next;
+	sys_snode_t hash_node;
 	struct net_context *context;
 	struct net_pkt send_data;
 	struct net_buf *queue_recv_data;
@@ -314,6 +376,7 @@ struct tcp { /* TCP connection */
 	int unacked_len;
 	atomic_t ref_count;
 	atomic_t backlog;
+	uint16_t hash; /* Bucket of the connection hash table */
 	enum tcp_state state;
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
@@ -335,7 +398,11 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_ca ca;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_scoreboard sack;
+	uint32_t sack_last_seq; /* Start of the latest out-of-order data */
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -350,6 +417,9 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_ok : 1; /* SACK permitted by both ends */
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -606,6 +606,17 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 	}
 	p = (uint32_t *)data;
 
+#if !defined(CONFIG_NET_CHKSUM_GENERIC)
+	/* The architecture kernel only pays off past a few vectors */
+	if (pending >= 64) {
+		size_t count = pending / sizeof(uint32_t);
+
+		sum += net_chksum_words(p, count);
+		pending -= count * sizeof(uint32_t);
+		p += count;
+	}
+#endif
+
 	/* Do loop unrolling for the very large data sets */
 	while (pending >= sizeof(uint32_t) * 4) {
 		uint64_t sum_a = p[i];
@@ -647,37 +658,57 @@ uint16_t calc_chksum(uint16_t sum_in, const uint8_t *data, size_t len)
 }
 
 #if defined(CONFIG_NET_NATIVE_IP)
-static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
+/* Find the fragment holding the packet data at @a offset, which is then
+ * made relative to that fragment.
+ */
+static struct net_buf *pkt_chksum_frag(struct net_pkt *pkt, size_t *offset)
 {
-	struct net_pkt_cursor *cur = &pkt->cursor;
+	struct net_buf *buf = pkt->buffer;
+
+	while (buf && *offset >= buf->len) {
+		*offset -= buf->len;
+		buf = buf->frags;
+	}
+
+	return buf;
+}
+
+/* Sum the packet data from @a offset to its end. The fragments are walked
+ * directly, leaving the packet cursor alone.
+ */
+static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, size_t offset, uint16_t sum)
+{
+	struct net_buf *buf = pkt_chksum_frag(pkt, &offset);
+	const uint8_t *pos;
 	size_t len;
 
-	if (!cur->buf || !cur->pos) {
+	if (!buf) {
 		return sum;
 	}
 
-	len = cur->buf->len - (cur->pos - cur->buf->data);
+	pos = buf->data + offset;
+	len = buf->len - offset;
 
-	while (cur->buf) {
-		sum = calc_chksum(sum, cur->pos, len);
+	while (buf) {
+		sum = calc_chksum(sum, pos, len);
 
-		cur->buf = cur->buf->frags;
-		if (!cur->buf || !cur->buf->len) {
+		buf = buf->frags;
+		if (!buf || !buf->len) {
 			break;
 		}
 
-		cur->pos = cur->buf->data;
+		pos = buf->data;
 
 		if (len % 2) {
-			sum += *cur->pos;
-			if (sum < *cur->pos) {
+			sum += *pos;
+			if (sum < *pos) {
 				sum++;
 			}
 
-			cur->pos++;
-			len = cur->buf->len - 1;
+			pos++;
+			len = buf->len - 1;
 		} else {
-			len = cur->buf->len;
+			len = buf->len;
 		}
 	}
 
@@ -688,8 +719,8 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 {
 	size_t len = 0U;
 	uint16_t sum = 0U;
-	struct net_pkt_cursor backup;
-	bool ow;
+	struct net_buf *buf;
+	size_t offset;
 
 	if (IS_ENABLED(CONFIG_NET_IPV4) &&
 	    net_pkt_family(pkt) == NET_AF_INET) {
@@ -710,25 +741,17 @@ uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto)
 		return 0;
 	}
 
-	net_pkt_cursor_backup(pkt, &backup);
-	net_pkt_cursor_init(pkt);
-
-	ow = net_pkt_is_being_overwritten(pkt);
-	net_pkt_set_overwrite(pkt, true);
-
-	net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) - len);
-
-	sum = calc_chksum(sum, pkt->cursor.pos, len);
-	net_pkt_skip(pkt, len + net_pkt_ip_opts_len(pkt));
+	/* The source and destination addresses end the IP header */
+	offset = net_pkt_ip_hdr_len(pkt) - len;
+	buf = pkt_chksum_frag(pkt, &offset);
+	if (buf && len > 0) {
+		sum = calc_chksum(sum, buf->data + offset, len);
+	}
 
-	sum = pkt_calc_chksum(pkt, sum);
+	sum = pkt_calc_chksum(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt), sum);
 
 	sum = (sum == 0U) ? 0xffff : net_htons(sum);
 
-	net_pkt_cursor_restore(pkt, &backup);
-
-	net_pkt_set_overwrite(pkt, ow);
-
 	return ~sum;
 }
 #endif
@@ -679,6 +679,38 @@ static void ethernet_update_tx_stats(struct net_if *iface, struct net_pkt *pkt)
 	}
 }
 
+#if defined(CONFIG_NET_GSO)
+static int ethernet_send(struct net_if *iface, struct net_pkt *pkt);
+
+static int ethernet_gso_send(struct net_pkt *seg, void *user_data)
+{
+	struct net_if *iface = user_data;
+	int ret;
+
+	ret = ethernet_send(iface, seg);
+	if (ret < 0) {
+		net_pkt_unref(seg);
+	}
+
+	return ret;
+}
+
+/* A GSO packet is cut into segments once its destination is resolved, and
+ * each segment then gets its own Ethernet header.
+ */
+static int ethernet_send_gso(struct net_if *iface, struct net_pkt *pkt)
+{
+	int ret;
+
+	ret = net_gso_segment(pkt, ethernet_gso_send, iface);
+	if (ret >= 0) {
+		net_pkt_unref(pkt);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_GSO */
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -754,6 +786,13 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		goto error;
 	}
 
+#if defined(CONFIG_NET_GSO)
+	if (net_pkt_gso_size(pkt) > 0U &&
+	    !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		return ethernet_send_gso(iface, pkt);
+	}
+#endif
+
 	/* If the ll dst addr has not been set before, let's assume
 	 * temporarily it's a broadcast one. When filling the header,
 	 * it might detect this should be multicast and act accordingly.
@@ -375,6 +375,13 @@ void http_server_release_client(struct http_client_ctx *client)
 		}
 	}
 
+#ifdef CONFIG_OBJ_CORE_ARENA
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
+		/* The arena is initialized again for the next connection */
+		k_obj_core_unlink(K_OBJ_CORE(&client->header_capture_ctx.arena));
+	}
+#endif /* CONFIG_OBJ_CORE_ARENA */
+
 	memset(client, 0, sizeof(struct http_client_ctx));
 	client->fd = INVALID_SOCK;
 }
@@ -435,6 +442,12 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 
 	memset(client->buffer, 0, sizeof(client->buffer));
 	memset(client->url_buffer, 0, sizeof(client->url_buffer));
+
+	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
+		k_arena_init(&client->header_capture_ctx.arena, client->header_capture_ctx.buffer,
+			     sizeof(client->header_capture_ctx.buffer));
+	}
+
 	k_work_init_delayable(&client->inactivity_timer, client_timeout);
 	http_client_timer_restart(client);
 
@@ -457,7 +470,7 @@ static int handle_http_preface(struct http_client_ctx *client)
 
 	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
 		client->header_capture_ctx.count = 0;
-		client->header_capture_ctx.cursor = 0;
+		k_arena_reset(&client->header_capture_ctx.arena);
 		client->header_capture_ctx.status = HTTP_HEADER_STATUS_OK;
 	}
 
@@ -746,8 +746,7 @@ not_supported:
 static void check_user_request_headers(struct http_header_capture_ctx *ctx, const char *buf)
 {
 	size_t header_len;
-	char *dest = &ctx->buffer[ctx->cursor];
-	size_t remaining = sizeof(ctx->buffer) - ctx->cursor;
+	char *dest;
 
 	ctx->store_next_value = false;
 
@@ -761,7 +760,9 @@ static void check_user_request_headers(struct http_header_capture_ctx *ctx, cons
 				break;
 			}
 
-			if (remaining < header_len + 1) {
+			/* Strings are packed without any alignment */
+			dest = k_arena_aligned_alloc(&ctx->arena, 1, header_len + 1);
+			if (dest == NULL) {
 				LOG_DBG("Header '%s' dropped: buffer too small for name",
 					header->name);
 				ctx->status = HTTP_HEADER_STATUS_DROPPED;
@@ -771,7 +772,6 @@ static void check_user_request_headers(struct http_header_capture_ctx *ctx, cons
 			memcpy(dest, header->name, header_len + 1);
 
 			ctx->headers[ctx->count].name = dest;
-			ctx->cursor += (header_len + 1);
 			ctx->store_next_value = true;
 			break;
 		}
@@ -828,7 +828,6 @@ static void populate_user_request_header(struct http_header_capture_ctx *ctx, co
 {
 	char *dest;
 	size_t value_len;
-	size_t remaining;
 
 	if (ctx->store_next_value == false) {
 		return;
@@ -836,18 +835,16 @@ static void populate_user_request_header(struct http_header_capture_ctx *ctx, co
 
 	ctx->store_next_value = false;
 	value_len = strlen(buf);
-	remaining = sizeof(ctx->buffer) - ctx->cursor;
 
-	if (value_len + 1 >= remaining) {
+	dest = k_arena_aligned_alloc(&ctx->arena, 1, value_len + 1);
+	if (dest == NULL) {
 		LOG_DBG("Header '%s' dropped: buffer too small for value",
 			ctx->headers[ctx->count].name);
 		ctx->status = HTTP_HEADER_STATUS_DROPPED;
 		return;
 	}
 
-	dest = &ctx->buffer[ctx->cursor];
 	memcpy(dest, buf, value_len + 1);
-	ctx->cursor += (value_len + 1);
 
 	ctx->headers[ctx->count].value = dest;
 	ctx->count++;
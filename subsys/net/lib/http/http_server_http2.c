@@ -951,7 +951,7 @@ static int enter_http_frame_headers_state(struct http_client_ctx *client)
 	if (IS_ENABLED(CONFIG_HTTP_SERVER_CAPTURE_HEADERS)) {
 		/* Reset header capture state for new headers frame */
 		client->header_capture_ctx.count = 0;
-		client->header_capture_ctx.cursor = 0;
+		k_arena_reset(&client->header_capture_ctx.arena);
 		client->header_capture_ctx.status = HTTP_HEADER_STATUS_OK;
 		client->header_capture_ctx.current_stream = stream;
 	}
@@ -1317,8 +1317,7 @@ static void check_user_request_headers_http2(struct http_header_capture_ctx *ctx
 					     struct http_hpack_header_buf *hdr_buf)
 {
 	size_t required_len;
-	char *dest = &ctx->buffer[ctx->cursor];
-	size_t remaining = sizeof(ctx->buffer) - ctx->cursor;
+	char *dest;
 	struct http_header *current_header = &ctx->headers[ctx->count];
 
 	STRUCT_SECTION_FOREACH(http_header_name, header) {
@@ -1332,7 +1331,9 @@ static void check_user_request_headers_http2(struct http_header_capture_ctx *ctx
 				break;
 			}
 
-			if (remaining < required_len) {
+			/* Strings are packed without any alignment */
+			dest = k_arena_aligned_alloc(&ctx->arena, 1, required_len);
+			if (dest == NULL) {
 				LOG_DBG("Header '%s' dropped: buffer too small", header->name);
 				ctx->status = HTTP_HEADER_STATUS_DROPPED;
 				break;
@@ -1345,14 +1346,12 @@ static void check_user_request_headers_http2(struct http_header_capture_ctx *ctx
 			memcpy(dest, header->name, hdr_buf->name_len);
 			dest[hdr_buf->name_len] = '\0';
 			current_header->name = dest;
-			ctx->cursor += (hdr_buf->name_len + 1);
 			dest += (hdr_buf->name_len + 1);
 
 			/* Copy header value */
 			memcpy(dest, hdr_buf->value, hdr_buf->value_len);
 			dest[hdr_buf->value_len] = '\0';
 			current_header->value = dest;
-			ctx->cursor += (hdr_buf->value_len + 1);
 
 			ctx->count++;
 			break;
@@ -15,6 +15,10 @@ LOG_MODULE_DECLARE(net_shell);
 #include <zephyr/sys/slist.h>
 #endif
 
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+#include "tcp_ca.h"
+#endif
+
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_NATIVE)
 static void context_cb(struct net_context *context, void *user_data)
 {
@@ -131,6 +135,28 @@ static void tcp_cb(struct tcp *conn, void *user_data)
 	(*count)++;
 }
 
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+static void tcp_ca_cb(struct tcp *conn, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *sh = data->sh;
+
+	if (conn->state == TCP_LISTEN) {
+		PR("%p %-8s\n", conn, conn->ca.ops->name);
+		return;
+	}
+
+	if (!conn->ca.rtt_valid) {
+		PR("%p %-8s %5u %8u      -       -\n", conn, conn->ca.ops->name,
+		   conn->ca.cwnd, conn->ca.ssthresh);
+		return;
+	}
+
+	PR("%p %-8s %5u %8u %6u  %6u\n", conn, conn->ca.ops->name,
+	   conn->ca.cwnd, conn->ca.ssthresh, conn->ca.srtt, conn->ca.min_rtt);
+}
+#endif
+
 #if CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG
 static void tcp_sent_list_cb(struct tcp *conn, void *user_data)
 {
@@ -248,6 +274,12 @@ static int cmd_net_conn(const struct shell *sh, size_t argc, char *argv[])
 	if (count == 0) {
 		PR("No TCP connections\n");
 	} else {
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+		PR("\nTCP        CC        Cwnd Ssthresh SRTT ms MinRTT ms\n");
+
+		net_tcp_foreach(tcp_ca_cb, &user_data);
+#endif
+
 #if CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG
 		/* Print information about pending packets */
 		struct tcp_detail_info details;
@@ -601,6 +601,9 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	PR("TCP seg rsterr %u\trst\t%u\n",
 	   GET_STAT(iface, tcp.rsterr),
 	   GET_STAT(iface, tcp.rst));
+	PR("TCP fast rexmit %u\trto\t%u\n",
+	   GET_STAT(iface, tcp.fast_rexmit),
+	   GET_STAT(iface, tcp.rto));
 	PR("TCP conn drop  %u\tconnrst\t%u\n",
 	   GET_STAT(iface, tcp.conndrop),
 	   GET_STAT(iface, tcp.connrst));
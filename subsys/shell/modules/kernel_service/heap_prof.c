@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/sys/heap_profiler.h>
+
+static void heap_prof_print_line(const char *line, void *user_data)
+{
+	const struct shell *sh = user_data;
+
+	shell_print(sh, "%s", line);
+}
+
+static int cmd_kernel_heap_prof(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t dropped = sys_heap_profiler_dropped_get();
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_profiler_dump(heap_prof_print_line, (void *)sh);
+
+	if (dropped != 0U) {
+		shell_warn(sh, "%u samples dropped, increase the profiler tables", dropped);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_heap_prof_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_heap_profiler_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_heap_prof,
+	SHELL_CMD(reset, NULL, "Reset the cumulative heap profile.", cmd_kernel_heap_prof_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+KERNEL_CMD_ADD(heap_prof, &sub_kernel_heap_prof,
+	       "Heap profile by allocation site, in pprof legacy text format.",
+	       cmd_kernel_heap_prof);
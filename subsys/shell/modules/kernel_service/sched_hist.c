@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/obj_core.h>
+
+static struct k_sched_histograms hist_raw[CONFIG_MP_MAX_NUM_CPUS];
+
+static int sched_obj_core_get(struct k_obj_core *obj_core, void *data)
+{
+	*(struct k_obj_core **)data = obj_core;
+
+	/* There is a single scheduler object */
+	return 1;
+}
+
+static struct k_obj_core *sched_obj_core_find(const struct shell *sh)
+{
+	struct k_obj_type *type = k_obj_type_find(K_OBJ_TYPE_SCHED_ID);
+	struct k_obj_core *obj_core = NULL;
+
+	if (type != NULL) {
+		k_obj_type_walk_locked(type, sched_obj_core_get, &obj_core);
+	}
+
+	if (obj_core == NULL) {
+		shell_error(sh, "Scheduler histograms not found");
+	}
+
+	return obj_core;
+}
+
+static void hist_print(const struct shell *sh, const char *name,
+		       const struct k_sched_histogram *hist)
+{
+	uint64_t average = (hist->count == 0U) ? 0U : hist->total / hist->count;
+
+	shell_print(sh, "  %s: %u samples, avg %llu cycles (%llu ns), max %u cycles (%llu ns)",
+		    name, hist->count, average, k_cyc_to_ns_floor64(average), hist->max,
+		    k_cyc_to_ns_floor64(hist->max));
+
+	for (unsigned int i = 0; i < K_SCHED_HISTOGRAM_BUCKETS; i++) {
+		uint64_t low = (i == 0U) ? 0U : BIT64(i - 1U);
+
+		if (hist->buckets[i] == 0U) {
+			continue;
+		}
+
+		if (i == K_SCHED_HISTOGRAM_BUCKETS - 1U) {
+			shell_print(sh, "    >= %10llu : %u", low, hist->buckets[i]);
+		} else {
+			shell_print(sh, "    <  %10llu : %u", BIT64(i), hist->buckets[i]);
+		}
+	}
+}
+
+static int cmd_kernel_sched_hist(const struct shell *sh, size_t argc, char **argv)
+{
+	struct k_obj_core *obj_core = sched_obj_core_find(sh);
+	int err;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (obj_core == NULL) {
+		return -ENOEXEC;
+	}
+
+	err = k_obj_core_stats_raw(obj_core, hist_raw, sizeof(hist_raw));
+	if (err != 0) {
+		shell_error(sh, "Failed to read scheduler histograms (err %d)", err);
+		return -ENOEXEC;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		shell_print(sh, "CPU %u:", i);
+		hist_print(sh, "run queue wait", &hist_raw[i].runq_wait);
+		hist_print(sh, "context switch", &hist_raw[i].switch_latency);
+		hist_print(sh, "ISR wakeup", &hist_raw[i].isr_wake);
+		hist_print(sh, "scheduler lock hold", &hist_raw[i].lock_hold);
+	}
+
+	return 0;
+}
+
+static int cmd_kernel_sched_hist_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	struct k_obj_core *obj_core = sched_obj_core_find(sh);
+	int err;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (obj_core == NULL) {
+		return -ENOEXEC;
+	}
+
+	err = k_obj_core_stats_reset(obj_core);
+	if (err != 0) {
+		shell_error(sh, "Failed to reset scheduler histograms (err %d)", err);
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_sched_hist,
+	SHELL_CMD(reset, NULL, "Reset the scheduler histograms.", cmd_kernel_sched_hist_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+
+KERNEL_CMD_ADD(sched_hist, &sub_kernel_sched_hist,
+	       "Scheduler latency histograms, in cycles.", cmd_kernel_sched_hist);
@@ -406,6 +406,9 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_queue_get_exit(queue, timeout, data)                                      \
 	SEGGER_SYSVIEW_RecordEndCall(TID_QUEUE_GET)
 
+#define sys_port_trace_k_queue_get_bulk_enter(queue, count)
+#define sys_port_trace_k_queue_get_bulk_exit(queue, count, ret)
+
 #define sys_port_trace_k_queue_remove_enter(queue)                                                 \
 	SEGGER_SYSVIEW_RecordU32(TID_QUEUE_REMOVE, (uint32_t)(uintptr_t)queue)
 
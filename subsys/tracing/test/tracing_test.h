@@ -193,6 +193,8 @@
 	sys_trace_k_queue_get_blocking(queue, timeout)
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)                                       \
 	sys_trace_k_queue_get_exit(queue, timeout, ret)
+#define sys_port_trace_k_queue_get_bulk_enter(queue, count)
+#define sys_port_trace_k_queue_get_bulk_exit(queue, count, ret)
 #define sys_port_trace_k_queue_remove_enter(queue) sys_trace_k_queue_remove_enter(queue, data)
 #define sys_port_trace_k_queue_remove_exit(queue, ret)                                             \
 	sys_trace_k_queue_remove_exit(queue, data, ret)
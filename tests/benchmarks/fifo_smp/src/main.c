@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the throughput of a FIFO
+ * shared by an increasing number of producer and consumer threads running
+ * concurrently on an SMP system. Consumers hand the items back to their
+ * producer through a per-producer FIFO, so that a small pool of items is
+ * enough for each producer.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_PAIRS   CONFIG_MP_MAX_NUM_CPUS
+#define POOL_SIZE   32
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO K_PRIO_PREEMPT(5)
+
+struct producer;
+
+struct item {
+	void *fifo_reserved;
+	struct producer *owner;
+};
+
+struct producer {
+	struct k_fifo free;
+	struct item pool[POOL_SIZE];
+	struct k_thread thread;
+};
+
+static struct producer producers[MAX_PAIRS];
+static struct k_thread consumers[MAX_PAIRS];
+static struct item stop_items[MAX_PAIRS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_PAIRS, STACK_SIZE);
+static K_FIFO_DEFINE(shared);
+
+static void producer_thread(void *p1, void *p2, void *p3)
+{
+	struct producer *producer = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		struct item *item = k_fifo_get(&producer->free, K_FOREVER);
+
+		k_fifo_put(&shared, item);
+	}
+}
+
+static void consumer_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		struct item *item = k_fifo_get(&shared, K_FOREVER);
+
+		if (item->owner == NULL) {
+			break;
+		}
+
+		k_fifo_put(&item->owner->free, item);
+	}
+}
+
+static void report_stats(unsigned int num_pairs, uint64_t elapsed)
+{
+	uint64_t per_item = elapsed / ((uint64_t)num_pairs * CONFIG_BENCHMARK_NUM_ITERATIONS);
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "fifo_smp.item.%u.pairs", num_pairs);
+	snprintf(description, sizeof(description),
+		 "FIFO item with %u producers and consumers on %u CPUs", num_pairs,
+		 arch_num_cpus());
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, description,
+	       per_item, (uint32_t)timing_cycles_to_ns(per_item));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Elapsed  : %9llu cycles (%9u nsec)\n", elapsed,
+	       (uint32_t)timing_cycles_to_ns(elapsed));
+	printk("    Per item : %9llu cycles (%9u nsec)\n", per_item,
+	       (uint32_t)timing_cycles_to_ns(per_item));
+#endif
+}
+
+static uint64_t run_pairs(unsigned int num_pairs)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	for (i = 0; i < num_pairs; i++) {
+		struct producer *producer = &producers[i];
+
+		k_fifo_init(&producer->free);
+
+		for (unsigned int j = 0; j < POOL_SIZE; j++) {
+			producer->pool[j].owner = producer;
+			k_fifo_put(&producer->free, &producer->pool[j]);
+		}
+
+		k_thread_create(&consumers[i], stacks[2 * i], STACK_SIZE, consumer_thread,
+				NULL, NULL, NULL, THREAD_PRIO, 0, K_FOREVER);
+		k_thread_create(&producer->thread, stacks[2 * i + 1], STACK_SIZE,
+				producer_thread, producer, NULL, NULL, THREAD_PRIO, 0,
+				K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (i = 0; i < num_pairs; i++) {
+		k_thread_start(&consumers[i]);
+		k_thread_start(&producers[i].thread);
+	}
+
+	for (i = 0; i < num_pairs; i++) {
+		k_thread_join(&producers[i].thread, K_FOREVER);
+	}
+
+	/* The stop items are queued after all the items of the producers */
+	for (i = 0; i < num_pairs; i++) {
+		k_fifo_put(&shared, &stop_items[i]);
+	}
+
+	for (i = 0; i < num_pairs; i++) {
+		k_thread_join(&consumers[i], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+int main(void)
+{
+	timing_init();
+
+	printk("Time Measurements for %s FIFO\n",
+	       IS_ENABLED(CONFIG_QUEUE_LOCKLESS) ? "lockless" : "locked");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Start all the threads of a round before any of them preempts us */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(1));
+
+	timing_start();
+
+	for (unsigned int num_pairs = 1; num_pairs <= arch_num_cpus(); num_pairs++) {
+		report_stats(num_pairs, run_pairs(num_pairs));
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
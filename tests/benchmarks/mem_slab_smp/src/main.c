@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the cost of
+ * k_mem_slab_alloc() and k_mem_slab_free() while an increasing number of
+ * threads, running concurrently on an SMP system, keep replacing blocks of
+ * the same memory slab.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_THREADS  CONFIG_MP_MAX_NUM_CPUS
+#define WORKING_SET  CONFIG_BENCHMARK_WORKING_SET
+#define BLOCK_SIZE   64
+#define NUM_BLOCKS   (2 * MAX_THREADS * WORKING_SET)
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO  K_PRIO_PREEMPT(5)
+
+static struct k_thread threads[MAX_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static K_MEM_SLAB_DEFINE_STATIC(slab, BLOCK_SIZE, NUM_BLOCKS, 8);
+static atomic_t failures;
+
+/* Every thread gets its own pseudo-random sequence */
+static uint32_t rand_next(uint32_t *state)
+{
+	*state = *state * 1103515245U + 12345U;
+
+	return *state >> 16;
+}
+
+static void allocator(void *p1, void *p2, void *p3)
+{
+	uint32_t state = POINTER_TO_UINT(p1);
+	void *blocks[WORKING_SET] = { NULL };
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		unsigned int slot = rand_next(&state) % WORKING_SET;
+
+		if (blocks[slot] != NULL) {
+			k_mem_slab_free(&slab, blocks[slot]);
+		}
+
+		if (k_mem_slab_alloc(&slab, &blocks[slot], K_NO_WAIT) != 0) {
+			blocks[slot] = NULL;
+			atomic_inc(&failures);
+			continue;
+		}
+
+		/* Touch the block like a real user would */
+		memset(blocks[slot], i, BLOCK_SIZE);
+	}
+
+	for (unsigned int slot = 0; slot < WORKING_SET; slot++) {
+		if (blocks[slot] != NULL) {
+			k_mem_slab_free(&slab, blocks[slot]);
+		}
+	}
+}
+
+static void report_stats(unsigned int num_threads, uint64_t elapsed)
+{
+	uint64_t per_op = elapsed / ((uint64_t)num_threads * CONFIG_BENCHMARK_NUM_ITERATIONS);
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "mem_slab_smp.alloc_free.%u.threads", num_threads);
+	snprintf(description, sizeof(description),
+		 "Memory slab alloc and free with %u threads on %u CPUs", num_threads,
+		 arch_num_cpus());
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, description,
+	       per_op, (uint32_t)timing_cycles_to_ns(per_op));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Elapsed    : %9llu cycles (%9u nsec)\n", elapsed,
+	       (uint32_t)timing_cycles_to_ns(elapsed));
+	printk("    Alloc/free : %9llu cycles (%9u nsec)\n", per_op,
+	       (uint32_t)timing_cycles_to_ns(per_op));
+#endif
+}
+
+static int run_threads(unsigned int num_threads, uint64_t *elapsed)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	atomic_clear(&failures);
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, allocator,
+				UINT_TO_POINTER(i + 1), NULL, NULL, THREAD_PRIO, 0,
+				K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	if (atomic_get(&failures) != 0) {
+		printk("%ld allocations failed\n", (long)atomic_get(&failures));
+		return -ENOMEM;
+	}
+
+	/* All the blocks are back, whether in the slab or in a cache */
+	if (k_mem_slab_num_used_get(&slab) != 0) {
+		printk("%u blocks still used\n", k_mem_slab_num_used_get(&slab));
+		return -EIO;
+	}
+
+	*elapsed = timing_cycles_get(&start, &finish);
+
+	return 0;
+}
+
+int main(void)
+{
+	uint64_t elapsed;
+	int ret = 0;
+
+	timing_init();
+
+	printk("Time Measurements for %s memory slabs\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_PER_CPU_CACHE) ? "cached" : "locked");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Start all the threads of a round before any of them preempts us */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(1));
+
+	timing_start();
+
+	for (unsigned int num_threads = 1; num_threads <= arch_num_cpus(); num_threads++) {
+		ret = run_threads(num_threads, &elapsed);
+		if (ret < 0) {
+			break;
+		}
+
+		report_stats(num_threads, elapsed);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
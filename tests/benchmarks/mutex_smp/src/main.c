@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the cost of acquiring a
+ * contended mutex while an increasing number of threads, running
+ * concurrently on an SMP system, repeatedly lock it to execute a short
+ * critical section.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_THREADS  CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO  K_PRIO_PREEMPT(5)
+
+static struct k_thread threads[MAX_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static K_MUTEX_DEFINE(mutex);
+
+static volatile unsigned int shared_counter;
+
+static void busy_work(void)
+{
+	for (volatile unsigned int i = 0; i < CONFIG_BENCHMARK_CRITICAL_SECTION; i++) {
+	}
+}
+
+static void locker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		shared_counter++;
+		busy_work();
+		k_mutex_unlock(&mutex);
+
+		busy_work();
+	}
+}
+
+static void report_stats(unsigned int num_threads, uint64_t elapsed)
+{
+	uint64_t per_lock = elapsed / ((uint64_t)num_threads * CONFIG_BENCHMARK_NUM_ITERATIONS);
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "mutex_smp.lock_unlock.%u.threads", num_threads);
+	snprintf(description, sizeof(description),
+		 "Mutex lock and unlock with %u threads on %u CPUs", num_threads,
+		 arch_num_cpus());
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, description,
+	       per_lock, (uint32_t)timing_cycles_to_ns(per_lock));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Elapsed  : %9llu cycles (%9u nsec)\n", elapsed,
+	       (uint32_t)timing_cycles_to_ns(elapsed));
+	printk("    Per lock : %9llu cycles (%9u nsec)\n", per_lock,
+	       (uint32_t)timing_cycles_to_ns(per_lock));
+#endif
+}
+
+static int run_threads(unsigned int num_threads, uint64_t *elapsed)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	shared_counter = 0;
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, locker,
+				NULL, NULL, NULL, THREAD_PRIO, 0, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (i = 0; i < num_threads; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	if (shared_counter != num_threads * CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Counter is %u, expected %u\n", shared_counter,
+		       num_threads * CONFIG_BENCHMARK_NUM_ITERATIONS);
+		return -EIO;
+	}
+
+	*elapsed = timing_cycles_get(&start, &finish);
+
+	return 0;
+}
+
+int main(void)
+{
+	uint64_t elapsed;
+	int ret = 0;
+
+	timing_init();
+
+	printk("Time Measurements for %s mutexes\n",
+	       IS_ENABLED(CONFIG_MUTEX_ADAPTIVE_SPIN) ? "adaptive" : "blocking");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Start all the threads of a round before any of them preempts us */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(1));
+
+	timing_start();
+
+	for (unsigned int num_threads = 1; num_threads <= arch_num_cpus(); num_threads++) {
+		ret = run_threads(num_threads, &elapsed);
+		if (ret < 0) {
+			break;
+		}
+
+		report_stats(num_threads, elapsed);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required to
+ * allocate and free batches of network buffers, one at a time and with the
+ * bulk API.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net_buf.h>
+#include <stdio.h>
+
+#define MAX_BATCH CONFIG_BENCHMARK_MAX_BATCH
+#define BUF_SIZE  128
+
+NET_BUF_POOL_FIXED_DEFINE(bench_pool, MAX_BATCH, BUF_SIZE, 0, NULL);
+
+static struct net_buf *bufs[MAX_BATCH];
+
+static void report_stats(const char *api, const char *how, unsigned int batch,
+			 uint64_t total)
+{
+	uint64_t per_buf = total / ((uint64_t)batch * CONFIG_BENCHMARK_NUM_ITERATIONS);
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "net_buf.%s.%u.bufs", api, batch);
+	snprintf(description, sizeof(description),
+		 "Alloc and free %u buffers %s, per buffer", batch, how);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu cycles , %7u ns :\n", tag, description,
+	       per_buf, (uint32_t)timing_cycles_to_ns(per_buf));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7llu cycles (%7u nsec)\n", description, per_buf,
+	       (uint32_t)timing_cycles_to_ns(per_buf));
+#endif
+}
+
+static int bench_single(unsigned int batch, uint64_t *total)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (unsigned int j = 0; j < batch; j++) {
+			bufs[j] = net_buf_alloc_len(&bench_pool, BUF_SIZE, K_NO_WAIT);
+			if (bufs[j] == NULL) {
+				return -ENOMEM;
+			}
+		}
+
+		for (unsigned int j = 0; j < batch; j++) {
+			net_buf_unref(bufs[j]);
+		}
+	}
+
+	finish = timing_counter_get();
+
+	*total = timing_cycles_get(&start, &finish);
+
+	return 0;
+}
+
+static int bench_bulk(unsigned int batch, uint64_t *total)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		if (net_buf_alloc_bulk(&bench_pool, BUF_SIZE, bufs, batch, K_NO_WAIT) != batch) {
+			return -ENOMEM;
+		}
+
+		net_buf_unref_chain_bulk(bufs, batch);
+	}
+
+	finish = timing_counter_get();
+
+	*total = timing_cycles_get(&start, &finish);
+
+	return 0;
+}
+
+int main(void)
+{
+	uint64_t total;
+	int ret = 0;
+
+	timing_init();
+
+	printk("Time Measurements for net_buf bulk allocation\n");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (unsigned int batch = 1; batch <= MAX_BATCH; batch *= 2) {
+		ret = bench_single(batch, &total);
+		if (ret < 0) {
+			printk("Failed to allocate %u buffers one by one\n", batch);
+			break;
+		}
+
+		report_stats("single", "one by one", batch, total);
+
+		ret = bench_bulk(batch, &total);
+		if (ret < 0) {
+			printk("Failed to allocate %u buffers in bulk\n", batch);
+			break;
+		}
+
+		report_stats("bulk", "in bulk", batch, total);
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
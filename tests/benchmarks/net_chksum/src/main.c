@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required by
+ * calc_chksum() to compute the Internet checksum of data of various sizes.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/random/random.h>
+#include <stdio.h>
+
+#include "net_private.h"
+
+#define MAX_DATA_LEN 9000
+
+/* From an IPv4 header to a jumbo frame */
+static const size_t data_lens[] = { 20, 40, 64, 128, 256, 576, 1280, 1500, 4096, MAX_DATA_LEN };
+
+/* One more byte for measuring data starting at an odd address */
+static uint8_t data[MAX_DATA_LEN + 1] __aligned(16);
+
+static volatile uint16_t result;
+
+static uint16_t calc_chksum_ref(uint16_t sum, const uint8_t *buf, size_t len)
+{
+	uint32_t acc = sum;
+
+	for (size_t i = 0; i < len; i++) {
+		acc += (i % 2) ? buf[i] : buf[i] << 8;
+	}
+
+	while (acc >> 16) {
+		acc = (acc & 0xffff) + (acc >> 16);
+	}
+
+	return acc;
+}
+
+static void report_stats(size_t len, bool odd, uint64_t total, uint64_t minimum,
+			 uint64_t maximum)
+{
+	uint64_t average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "net.chksum.%04zu.%s", len, odd ? "odd" : "aligned");
+	snprintf(description, sizeof(description), "Checksum of %zu %s bytes", len,
+		 odd ? "odd" : "aligned");
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static int measure(size_t len, bool odd)
+{
+	const uint8_t *buf = odd ? data + 1 : data;
+	uint64_t minimum = UINT64_MAX;
+	uint64_t maximum = 0;
+	uint64_t total = 0;
+	timing_t start;
+	timing_t finish;
+
+	if (calc_chksum(0, buf, len) != calc_chksum_ref(0, buf, len)) {
+		printk("Wrong checksum of %zu %s bytes\n", len, odd ? "odd" : "aligned");
+		return -EIO;
+	}
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		uint64_t cycles;
+
+		start = timing_counter_get();
+		result = calc_chksum(0, buf, len);
+		finish = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &finish);
+		minimum = MIN(minimum, cycles);
+		maximum = MAX(maximum, cycles);
+		total += cycles;
+	}
+
+	report_stats(len, odd, total, minimum, maximum);
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret = 0;
+
+	timing_init();
+
+	printk("Time Measurements for %s checksum\n",
+	       IS_ENABLED(CONFIG_NET_CHKSUM_SSE2) ? "SSE2" :
+	       IS_ENABLED(CONFIG_NET_CHKSUM_NEON) ? "NEON" :
+	       IS_ENABLED(CONFIG_NET_CHKSUM_MVE) ? "MVE" : "generic");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	sys_rand_get(data, sizeof(data));
+
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(data_lens); i++) {
+		ret = measure(data_lens[i], false);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	ret = measure(1500, true);
+
+out:
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
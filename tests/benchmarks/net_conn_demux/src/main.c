@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required by
+ * net_conn_input() to find the handler of a received UDP packet while a
+ * varying number of connections are registered.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/dummy.h>
+#include <stdio.h>
+
+#include "connection.h"
+#include "ipv4.h"
+#include "udp_internal.h"
+
+#define LOCAL_PORT       5001
+#define REMOTE_PORT_BASE 10000
+
+static struct net_in_addr local_addr = { { { 192, 0, 2, 1 } } };
+static struct net_conn_handle *handles[CONFIG_BENCHMARK_NUM_CONNS];
+static int delivered;
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_if_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_conn_demux_test, "net_conn_demux_test", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static enum net_verdict conn_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+	ARG_UNUSED(user_data);
+
+	/* The packet is reused for the next iteration, do not consume it */
+	delivered++;
+
+	return NET_OK;
+}
+
+static void remote_addr_get(unsigned int idx, struct net_in_addr *addr)
+{
+	addr->s4_addr[0] = 198;
+	addr->s4_addr[1] = 51;
+	addr->s4_addr[2] = 100 + idx / 250;
+	addr->s4_addr[3] = 1 + idx % 250;
+}
+
+static int conn_add(unsigned int idx)
+{
+	struct net_sockaddr_in remote = { .sin_family = NET_AF_INET };
+	struct net_sockaddr_in local = { .sin_family = NET_AF_INET };
+
+	remote_addr_get(idx, &remote.sin_addr);
+	net_ipaddr_copy(&local.sin_addr, &local_addr);
+
+	return net_conn_register(NET_IPPROTO_UDP, NET_SOCK_DGRAM, NET_AF_INET,
+				 (struct net_sockaddr *)&remote,
+				 (struct net_sockaddr *)&local,
+				 REMOTE_PORT_BASE + idx, LOCAL_PORT,
+				 NULL, conn_cb, NULL, &handles[idx]);
+}
+
+static struct net_pkt *pkt_create(struct net_if *iface, unsigned int idx)
+{
+	struct net_in_addr remote;
+	struct net_pkt *pkt;
+
+	remote_addr_get(idx, &remote);
+
+	pkt = net_pkt_alloc_with_buffer(iface, 0, NET_AF_INET, NET_IPPROTO_UDP,
+					K_FOREVER);
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	if (net_ipv4_create(pkt, &remote, &local_addr) ||
+	    net_udp_create(pkt, net_htons(REMOTE_PORT_BASE + idx),
+			   net_htons(LOCAL_PORT))) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_ipv4_finalize(pkt, NET_IPPROTO_UDP);
+
+	return pkt;
+}
+
+static void report_stats(unsigned int num_conns, uint64_t total, uint64_t minimum,
+			 uint64_t maximum)
+{
+	uint64_t average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "net.conn_input.%04u.conns", num_conns);
+	snprintf(description, sizeof(description), "Demux UDP packet with %u connections",
+		 num_conns);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+/* Demultiplex a packet for the oldest connection, which is the last one
+ * found when walking the connection list.
+ */
+static int measure(struct net_pkt *pkt, unsigned int num_conns)
+{
+	union net_ip_header ip_hdr;
+	union net_proto_header proto_hdr;
+	uint64_t minimum = UINT64_MAX;
+	uint64_t maximum = 0;
+	uint64_t total = 0;
+	timing_t start;
+	timing_t finish;
+
+	ip_hdr.ipv4 = NET_IPV4_HDR(pkt);
+	proto_hdr.udp = (struct net_udp_hdr *)((uint8_t *)ip_hdr.ipv4 +
+					       net_pkt_ip_hdr_len(pkt));
+
+	delivered = 0;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		uint64_t cycles;
+
+		start = timing_counter_get();
+		net_conn_input(pkt, &ip_hdr, NET_IPPROTO_UDP, &proto_hdr);
+		finish = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &finish);
+		minimum = MIN(minimum, cycles);
+		maximum = MAX(maximum, cycles);
+		total += cycles;
+	}
+
+	if (delivered != CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Only %d of %d packets delivered\n", delivered,
+		       CONFIG_BENCHMARK_NUM_ITERATIONS);
+		return -EIO;
+	}
+
+	report_stats(num_conns, total, minimum, maximum);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	unsigned int registered = 0;
+	struct net_pkt *pkt;
+	int ret = 0;
+
+	BUILD_ASSERT(CONFIG_BENCHMARK_NUM_CONNS <= CONFIG_NET_MAX_CONN);
+
+	timing_init();
+
+	printk("Time Measurements for %s connection demux\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hashed" : "linear");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	net_if_ipv4_addr_add(iface, &local_addr, NET_ADDR_MANUAL, 0);
+
+	pkt = pkt_create(iface, 0);
+	if (pkt == NULL) {
+		printk("Cannot create packet\n");
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	timing_start();
+
+	for (unsigned int target = 1; target <= CONFIG_BENCHMARK_NUM_CONNS; target *= 2) {
+		while (registered < target) {
+			ret = conn_add(registered);
+			if (ret < 0) {
+				printk("Cannot register connection %u (%d)\n", registered, ret);
+				goto out;
+			}
+			registered++;
+		}
+
+		ret = measure(pkt, registered);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	timing_stop();
+
+	net_pkt_unref(pkt);
+
+	for (unsigned int i = 0; i < registered; i++) {
+		net_conn_unregister(handles[i]);
+	}
+
+out:
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
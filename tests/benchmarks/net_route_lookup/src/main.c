@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required by
+ * net_route_lookup() to find the route of an IPv6 destination while a
+ * varying number of routes are installed.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/dummy.h>
+#include <stdio.h>
+
+#include "ipv6.h"
+#include "route.h"
+
+static struct net_in6_addr nexthop_addr = { { { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+						0, 0, 0, 0, 0, 0, 0, 0x2 } } };
+static struct net_route_entry *routes[CONFIG_BENCHMARK_NUM_ROUTES];
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_if_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_route_lookup_test, "net_route_lookup_test", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* 2001:db8:<idx>::/64, the interface identifier is left for the caller */
+static void prefix_get(unsigned int idx, struct net_in6_addr *addr)
+{
+	memset(addr, 0, sizeof(*addr));
+
+	addr->s6_addr[0] = 0x20;
+	addr->s6_addr[1] = 0x01;
+	addr->s6_addr[2] = 0x0d;
+	addr->s6_addr[3] = 0xb8;
+	addr->s6_addr[4] = idx >> 8;
+	addr->s6_addr[5] = idx & 0xff;
+}
+
+static int route_add(struct net_if *iface, unsigned int idx)
+{
+	struct net_in6_addr prefix;
+
+	prefix_get(idx, &prefix);
+
+	routes[idx] = net_route_add(iface, &prefix, 64, &nexthop_addr,
+				    NET_IPV6_ND_INFINITE_LIFETIME,
+				    NET_ROUTE_PREFERENCE_MEDIUM);
+
+	return routes[idx] == NULL ? -ENOMEM : 0;
+}
+
+static void report_stats(unsigned int num_routes, uint64_t total, uint64_t minimum,
+			 uint64_t maximum)
+{
+	uint64_t average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "net.route_lookup.%04u.routes", num_routes);
+	snprintf(description, sizeof(description), "Lookup IPv6 route with %u routes",
+		 num_routes);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+/* Lookup a host address covered by the most recently added route, which
+ * sits in the last used slot of the routing table.
+ */
+static int measure(struct net_if *iface, unsigned int num_routes)
+{
+	struct net_route_entry *expected = routes[num_routes - 1];
+	uint64_t minimum = UINT64_MAX;
+	uint64_t maximum = 0;
+	uint64_t total = 0;
+	struct net_in6_addr dst;
+	timing_t start;
+	timing_t finish;
+
+	prefix_get(num_routes - 1, &dst);
+	dst.s6_addr[15] = 0x01;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		struct net_route_entry *route;
+		uint64_t cycles;
+
+		start = timing_counter_get();
+		route = net_route_lookup(iface, &dst);
+		finish = timing_counter_get();
+
+		if (route != expected) {
+			printk("Wrong route %p found, expected %p\n", route, expected);
+			return -EIO;
+		}
+
+		cycles = timing_cycles_get(&start, &finish);
+		minimum = MIN(minimum, cycles);
+		maximum = MAX(maximum, cycles);
+		total += cycles;
+	}
+
+	report_stats(num_routes, total, minimum, maximum);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	struct net_linkaddr lladdr = {
+		.type = NET_LINK_ETHERNET,
+		.len = 6,
+		.addr = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 },
+	};
+	unsigned int installed = 0;
+	int ret = 0;
+
+	BUILD_ASSERT(CONFIG_BENCHMARK_NUM_ROUTES <= CONFIG_NET_MAX_ROUTES);
+
+	timing_init();
+
+	printk("Time Measurements for %s route lookup\n",
+	       IS_ENABLED(CONFIG_NET_ROUTE_LPM) ? "trie" : "table");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	if (net_ipv6_nbr_add(iface, &nexthop_addr, &lladdr, true,
+			     NET_IPV6_NBR_STATE_REACHABLE) == NULL) {
+		printk("Cannot add next hop neighbor\n");
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	timing_start();
+
+	for (unsigned int target = 1; target <= CONFIG_BENCHMARK_NUM_ROUTES; target *= 2) {
+		while (installed < target) {
+			ret = route_add(iface, installed);
+			if (ret < 0) {
+				printk("Cannot add route %u (%d)\n", installed, ret);
+				goto out;
+			}
+			installed++;
+		}
+
+		ret = measure(iface, installed);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < installed; i++) {
+		net_route_del(routes[i]);
+	}
+
+out:
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
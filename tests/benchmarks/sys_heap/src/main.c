@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required by
+ * sys_heap_alloc() and sys_heap_free(), and the resulting fragmentation of
+ * the heap, for a workload made mostly of small allocations.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/sys/sys_heap.h>
+#include <stdio.h>
+
+#define NUM_BLOCKS  CONFIG_BENCHMARK_NUM_BLOCKS
+#define SMALL_MAX   128
+#define LARGE_MAX   1024
+
+struct block {
+	void *mem;
+	size_t size;
+};
+
+struct op_stats {
+	uint64_t total;
+	uint64_t minimum;
+	uint64_t maximum;
+	uint32_t count;
+};
+
+static uint8_t __aligned(8) heap_mem[CONFIG_BENCHMARK_HEAP_SIZE];
+static struct sys_heap heap;
+static struct block blocks[NUM_BLOCKS];
+static uint32_t rand_state = 1;
+
+static uint32_t rand_next(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+
+	return rand_state >> 16;
+}
+
+static size_t rand_size(void)
+{
+	if (rand_next() % 100 < CONFIG_BENCHMARK_LARGE_PERCENT) {
+		return SMALL_MAX + 1 + rand_next() % (LARGE_MAX - SMALL_MAX);
+	}
+
+	return 1 + rand_next() % SMALL_MAX;
+}
+
+static void op_stats_add(struct op_stats *stats, timing_t *start, timing_t *finish)
+{
+	uint64_t cycles = timing_cycles_get(start, finish);
+
+	stats->total += cycles;
+	stats->minimum = MIN(stats->minimum, cycles);
+	stats->maximum = MAX(stats->maximum, cycles);
+	stats->count++;
+}
+
+static void report_cycles(const char *op, struct op_stats *stats)
+{
+	uint64_t average = stats->total / MAX(stats->count, 1);
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "sys_heap.%s", op);
+	snprintf(description, sizeof(description), "sys_heap_%s()", op);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", stats->minimum,
+	       (uint32_t)timing_cycles_to_ns(stats->minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", stats->maximum,
+	       (uint32_t)timing_cycles_to_ns(stats->maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", stats->minimum,
+	       (uint32_t)timing_cycles_to_ns(stats->minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", stats->maximum,
+	       (uint32_t)timing_cycles_to_ns(stats->maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static void report_percent(const char *metric, const char *description, uint64_t value,
+			   uint64_t total)
+{
+	uint32_t percent = (uint32_t)(total == 0 ? 0 : (100 * value + total / 2) / total);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: sys_heap.%s - %s: %u percent\n", metric, description, percent);
+#else
+	printk("    %-30s : %3u%% (%llu / %llu)\n", description, percent, value, total);
+#endif
+}
+
+/* Largest block that can currently be allocated, found by bisection */
+static size_t largest_free_block(void)
+{
+	size_t low = 0;
+	size_t high = CONFIG_BENCHMARK_HEAP_SIZE;
+
+	while (low + 1 < high) {
+		size_t mid = low + (high - low) / 2;
+		void *mem = sys_heap_alloc(&heap, mid);
+
+		if (mem != NULL) {
+			sys_heap_free(&heap, mem);
+			low = mid;
+		} else {
+			high = mid;
+		}
+	}
+
+	return low;
+}
+
+int main(void)
+{
+	struct op_stats alloc_stats = { .minimum = UINT64_MAX };
+	struct op_stats free_stats = { .minimum = UINT64_MAX };
+	struct sys_memory_stats mem_stats;
+	uint32_t failures = 0;
+	size_t requested = 0;
+	size_t largest;
+	timing_t start;
+	timing_t finish;
+
+	timing_init();
+
+	printk("Time Measurements for %s sys_heap\n",
+	       IS_ENABLED(CONFIG_SYS_HEAP_SLAB) ? "slab" : "bucket");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	sys_heap_init(&heap, heap_mem, sizeof(heap_mem));
+
+	timing_start();
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		struct block *block = &blocks[rand_next() % NUM_BLOCKS];
+
+		if (block->mem != NULL) {
+			start = timing_counter_get();
+			sys_heap_free(&heap, block->mem);
+			finish = timing_counter_get();
+
+			op_stats_add(&free_stats, &start, &finish);
+			requested -= block->size;
+			block->mem = NULL;
+			continue;
+		}
+
+		block->size = rand_size();
+
+		start = timing_counter_get();
+		block->mem = sys_heap_alloc(&heap, block->size);
+		finish = timing_counter_get();
+
+		if (block->mem == NULL) {
+			failures++;
+			continue;
+		}
+
+		op_stats_add(&alloc_stats, &start, &finish);
+		requested += block->size;
+	}
+
+	timing_stop();
+
+	report_cycles("alloc", &alloc_stats);
+	report_cycles("free", &free_stats);
+
+#ifndef CONFIG_BENCHMARK_RECORDING
+	printk("------------------------------------\n");
+	printk("Fragmentation\n");
+#endif
+
+	/* Looking for the largest block may give the empty slab runs back to
+	 * the heap, do it before reading the statistics.
+	 */
+	largest = largest_free_block();
+	sys_heap_runtime_stats_get(&heap, &mem_stats);
+
+	report_percent("alloc_failures", "Failed allocations", failures,
+		       alloc_stats.count + failures);
+	report_percent("utilization", "Requested bytes in allocated memory", requested,
+		       mem_stats.allocated_bytes);
+	report_percent("largest_free", "Largest free block in free memory",
+		       largest, mem_stats.free_bytes);
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
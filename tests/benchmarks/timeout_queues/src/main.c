@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that will measure the length of time required
+ * to add and abort kernel timeouts while the timeout queue already holds a
+ * varying number of armed timeouts. The armed timeouts are spread over a
+ * wide range of expiries so that every level of the timeout queue is
+ * populated. With a tick rate of 1 Hz none of them ever expire while the
+ * measurements are taken.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+#include <stdio.h>
+
+#define MIN_DELAY_TICKS   1000U
+#define DELAY_SPAN_TICKS  (1U << 22)
+
+static struct _timeout timeouts[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static struct _timeout probe[CONFIG_BENCHMARK_NUM_ITERATIONS];
+
+static uint64_t add_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+static uint64_t abort_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+
+static uint32_t rand_state = 0x2545f491;
+
+static void timeout_handler(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	printk("Timeout expired unexpectedly\n");
+}
+
+/* Simple LCG, the values only need to be reproducible and spread out */
+static k_timeout_t random_delay(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+
+	return K_TICKS(MIN_DELAY_TICKS + (rand_state >> 8) % DELAY_SPAN_TICKS);
+}
+
+static void population_set(unsigned int *armed, unsigned int target)
+{
+	while (*armed < target) {
+		z_add_timeout(&timeouts[*armed], timeout_handler, random_delay());
+		(*armed)++;
+	}
+}
+
+static void population_clear(unsigned int armed)
+{
+	for (unsigned int i = 0; i < armed; i++) {
+		z_abort_timeout(&timeouts[i]);
+	}
+}
+
+static void test_add_abort(void)
+{
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		k_timeout_t delay = random_delay();
+
+		start = timing_counter_get();
+		z_add_timeout(&probe[i], timeout_handler, delay);
+		finish = timing_counter_get();
+
+		add_cycles[i] = timing_cycles_get(&start, &finish);
+	}
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&probe[i]);
+		finish = timing_counter_get();
+
+		abort_cycles[i] = timing_cycles_get(&start, &finish);
+	}
+}
+
+static void report_stats(uint64_t *cycles, unsigned int armed, const char *op)
+{
+	uint64_t minimum = cycles[0];
+	uint64_t maximum = cycles[0];
+	uint64_t total = 0;
+	uint64_t average;
+	char tag[50];
+	char description[120];
+	unsigned int i;
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		minimum = MIN(minimum, cycles[i]);
+		maximum = MAX(maximum, cycles[i]);
+		total += cycles[i];
+	}
+	average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+
+	snprintf(tag, sizeof(tag), "timeout.%s.%05u.armed", op, armed);
+	snprintf(description, sizeof(description), "%s timeout with %u timeouts armed",
+		 op, armed);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		printk("%-40s : %7llu cycles\n", tag, cycles[i]);
+	}
+#endif
+}
+
+int main(void)
+{
+	unsigned int armed = 0;
+	unsigned int target;
+
+	timing_init();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "timing wheel" : "simple");
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	timing_start();
+
+	for (target = 10; target <= CONFIG_BENCHMARK_NUM_TIMEOUTS; target *= 10) {
+		population_set(&armed, target);
+
+		test_add_abort();
+
+		report_stats(add_cycles, armed, "add");
+		report_stats(abort_cycles, armed, "abort");
+	}
+
+	population_clear(armed);
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
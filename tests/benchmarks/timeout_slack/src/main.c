@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the number of timer
+ * interrupts needed to service many periodic timers with unrelated periods,
+ * with and without timeout slack.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define NUM_TIMERS    CONFIG_BENCHMARK_NUM_TIMERS
+#define MIN_PERIOD_MS 10
+#define MAX_PERIOD_MS 50
+
+static struct k_timer timers[NUM_TIMERS];
+static atomic_t expiries;
+
+static void timer_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	atomic_inc(&expiries);
+}
+
+/* A fixed sequence, so that every variant runs the same set of periods */
+static uint32_t period_get(uint32_t *seed)
+{
+	*seed = *seed * 1103515245U + 12345U;
+
+	return MIN_PERIOD_MS + (*seed >> 16) % (MAX_PERIOD_MS - MIN_PERIOD_MS + 1);
+}
+
+static void report_count(const char *name, const char *description, uint64_t count)
+{
+	uint64_t per_second = count * MSEC_PER_SEC / CONFIG_BENCHMARK_DURATION_MS;
+	char tag[50];
+
+	snprintf(tag, sizeof(tag), "timeout_slack.%s.%u.timers", name, NUM_TIMERS);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7llu per second\n", tag, description, per_second);
+#else
+	ARG_UNUSED(tag);
+
+	printk("    %-24s: %7llu (%7llu per second)\n", description, count, per_second);
+#endif
+}
+
+int main(void)
+{
+	struct sys_clock_timeout_stats before;
+	struct sys_clock_timeout_stats after;
+	uint64_t expired;
+	uint64_t coalesced;
+	uint32_t seed = 1U;
+	int ret = 0;
+
+	printk("Timeout slack measurements with %u timers and %u%% slack\n", NUM_TIMERS,
+	       CONFIG_BENCHMARK_SLACK_PERCENT);
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		k_timer_init(timer, timer_expiry, NULL);
+	}
+
+	sys_clock_timeout_stats_get(&before);
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		uint32_t period = period_get(&seed);
+
+		k_timer_slack_set(timer,
+				  K_MSEC(period * CONFIG_BENCHMARK_SLACK_PERCENT / 100U));
+		k_timer_start(timer, K_MSEC(period), K_MSEC(period));
+	}
+
+	k_msleep(CONFIG_BENCHMARK_DURATION_MS);
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		k_timer_stop(timer);
+	}
+
+	sys_clock_timeout_stats_get(&after);
+
+	/* The sleep of this thread expired once as well */
+	expired = after.expired - before.expired;
+	coalesced = after.coalesced - before.coalesced;
+
+	if (expired < (uint64_t)atomic_get(&expiries)) {
+		printk("Only %llu of %ld timer expiries counted\n", expired,
+		       (long)atomic_get(&expiries));
+		ret = -EIO;
+	}
+
+#ifndef CONFIG_BENCHMARK_RECORDING
+	printk("------------------------------------\n");
+	printk("%u timers during %u ms\n", NUM_TIMERS, CONFIG_BENCHMARK_DURATION_MS);
+#endif
+	report_count("expired", "Timer expiries", expired);
+	report_count("coalesced", "Coalesced expiries", coalesced);
+	report_count("deferred", "Deferred expiries", after.deferred - before.deferred);
+	report_count("interrupts", "Timer interrupts", expired - coalesced);
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
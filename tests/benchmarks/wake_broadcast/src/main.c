@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the time required to wake up
+ * every thread pending on a condition variable, an event object or a
+ * semaphore while a varying number of threads are waiting on it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_WAITERS  CONFIG_BENCHMARK_NUM_WAITERS
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WAITER_PRIO  K_PRIO_PREEMPT(5)
+
+struct broadcast {
+	const char *name;
+	_wait_q_t *wait_q;
+	k_thread_entry_t waiter;
+	void (*signal)(void);
+};
+
+static K_MUTEX_DEFINE(mutex);
+static K_CONDVAR_DEFINE(condvar);
+static K_EVENT_DEFINE(event);
+static K_SEM_DEFINE(sem, 0, 1);
+
+static struct k_thread waiters[MAX_WAITERS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WAITERS, STACK_SIZE);
+static atomic_t woken;
+
+static void condvar_waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&mutex, K_FOREVER);
+
+	for (;;) {
+		k_condvar_wait(&condvar, &mutex, K_FOREVER);
+		atomic_inc(&woken);
+	}
+}
+
+static void condvar_signal(void)
+{
+	k_condvar_broadcast(&condvar);
+}
+
+static void event_waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		/* All the waiters are woken by the post, so whichever of them
+		 * comes back first can clear the event for the next round.
+		 */
+		k_event_wait(&event, BIT(0), true, K_FOREVER);
+		atomic_inc(&woken);
+	}
+}
+
+static void event_signal(void)
+{
+	k_event_post(&event, BIT(0));
+}
+
+static void sem_waiter(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		k_sem_take(&sem, K_FOREVER);
+		atomic_inc(&woken);
+	}
+}
+
+static void sem_signal(void)
+{
+	k_sem_reset(&sem);
+}
+
+static const struct broadcast broadcasts[] = {
+	{ "condvar_broadcast", &condvar.wait_q, condvar_waiter, condvar_signal },
+	{ "event_post", &event.wait_q, event_waiter, event_signal },
+	{ "sem_reset", &sem.wait_q, sem_waiter, sem_signal },
+};
+
+/* The waiters run at a lower priority than us, let them run until every
+ * one of them is pending on the object again.
+ */
+static void waiters_pend(const struct broadcast *bc, unsigned int num_waiters)
+{
+	unsigned int i = 0;
+
+	while (i < num_waiters) {
+		if (waiters[i].base.pended_on == bc->wait_q) {
+			i++;
+		} else {
+			k_msleep(1);
+		}
+	}
+}
+
+static void report_stats(const struct broadcast *bc, unsigned int num_waiters,
+			 uint64_t total, uint64_t minimum, uint64_t maximum)
+{
+	uint64_t average = total / CONFIG_BENCHMARK_NUM_ITERATIONS;
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "wake.%s.%02u.waiters", bc->name, num_waiters);
+	snprintf(description, sizeof(description), "%s with %u waiters", bc->name,
+		 num_waiters);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".min",
+	       description, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".max",
+	       description, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-8s - %s%-12s : %7llu cycles , %7u ns :\n", tag, ".avg",
+	       description, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", description);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static int measure(const struct broadcast *bc, unsigned int num_waiters)
+{
+	uint64_t minimum = UINT64_MAX;
+	uint64_t maximum = 0;
+	uint64_t total = 0;
+	timing_t start;
+	timing_t finish;
+	unsigned int i;
+
+	atomic_clear(&woken);
+
+	for (i = 0; i < num_waiters; i++) {
+		k_thread_create(&waiters[i], stacks[i], STACK_SIZE, bc->waiter,
+				NULL, NULL, NULL, WAITER_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		uint64_t cycles;
+
+		waiters_pend(bc, num_waiters);
+
+		start = timing_counter_get();
+		bc->signal();
+		finish = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &finish);
+		minimum = MIN(minimum, cycles);
+		maximum = MAX(maximum, cycles);
+		total += cycles;
+	}
+
+	waiters_pend(bc, num_waiters);
+
+	for (i = 0; i < num_waiters; i++) {
+		k_thread_abort(&waiters[i]);
+	}
+
+	if (atomic_get(&woken) != num_waiters * CONFIG_BENCHMARK_NUM_ITERATIONS) {
+		printk("Only %ld of %u wakeups done\n", (long)atomic_get(&woken),
+		       num_waiters * CONFIG_BENCHMARK_NUM_ITERATIONS);
+		return -EIO;
+	}
+
+	report_stats(bc, num_waiters, total, minimum, maximum);
+
+	return 0;
+}
+
+int main(void)
+{
+	int ret = 0;
+
+	timing_init();
+
+	printk("Time Measurements for broadcast wakeups on %u CPUs\n", arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Keep the waiters from running while the object is signaled */
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(1));
+
+	timing_start();
+
+	for (unsigned int num_waiters = 1; num_waiters <= MAX_WAITERS; num_waiters *= 2) {
+		ARRAY_FOR_EACH_PTR(broadcasts, bc) {
+			ret = measure(bc, num_waiters);
+			if (ret < 0) {
+				goto out;
+			}
+		}
+	}
+
+out:
+	timing_stop();
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains a benchmark that measures the deadline miss rates of
+ * periodic work items run by a work queue in submission order and earliest
+ * deadline first, for loads up to overload.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define PERIOD_US CONFIG_BENCHMARK_PERIOD_US
+#define NUM_JOBS  4
+#define URGENT    (NUM_JOBS - 1)
+
+/* Share of the load, in percent, and deadline of the jobs, in percent of
+ * the period. The urgent job is released last, after the relaxed ones.
+ */
+static const uint32_t job_share[NUM_JOBS] = { 30, 30, 30, 10 };
+static const uint32_t job_deadline[NUM_JOBS] = { 100, 100, 100, 20 };
+
+static const uint32_t loads[] = { 50, 90, 110, 150 };
+
+struct job {
+	struct k_work work;
+	uint32_t deadline;
+	uint32_t cost_us;
+	uint32_t completed;
+	uint32_t missed;
+	uint32_t overruns;
+};
+
+static K_THREAD_STACK_DEFINE(work_q_stack, 2048);
+static struct k_work_q work_q;
+static struct job jobs[NUM_JOBS];
+static bool use_deadline;
+
+static void job_handler(struct k_work *work)
+{
+	struct job *job = CONTAINER_OF(work, struct job, work);
+	uint32_t deadline = job->deadline;
+
+	k_busy_wait(job->cost_us);
+
+	job->completed++;
+	if ((int32_t)(k_cycle_get_32() - deadline) > 0) {
+		job->missed++;
+	}
+}
+
+static void release_jobs(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	for (int i = 0; i < NUM_JOBS; i++) {
+		struct job *job = &jobs[i];
+		uint32_t cycles = k_us_to_cyc_ceil32(PERIOD_US * job_deadline[i] / 100U);
+
+		/* Still waiting from the previous period, this release is lost */
+		if ((k_work_busy_get(&job->work) & K_WORK_QUEUED) != 0) {
+			job->overruns++;
+			continue;
+		}
+
+		job->deadline = k_cycle_get_32() + cycles;
+
+		if (use_deadline) {
+			(void)k_work_submit_with_deadline(&work_q, &job->work, cycles);
+		} else {
+			(void)k_work_submit_to_queue(&work_q, &job->work);
+		}
+	}
+}
+
+K_TIMER_DEFINE(release_timer, release_jobs, NULL);
+
+static void report_stats(const char *mode, const char *which, uint32_t load,
+			 uint32_t missed, uint32_t completed)
+{
+	char tag[50];
+	char description[80];
+
+	snprintf(tag, sizeof(tag), "workq.%s.%s.load_%u", mode, which, load);
+	snprintf(description, sizeof(description), "%s, %s jobs, %u%% load",
+		 use_deadline ? "Earliest deadline first" : "Submission order", which, load);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s : %7u missed , %7u completed :\n", tag, description,
+	       missed, completed);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-50s : %7u missed of %7u (%3u%%)\n", description, missed, completed,
+	       (completed != 0U) ? (100U * missed / completed) : 0U);
+#endif
+}
+
+static int bench_load(uint32_t load)
+{
+	struct k_work_queue_deadline_stats stats;
+	uint32_t missed = 0;
+	uint32_t completed = 0;
+	uint32_t run = 0;
+
+	for (int i = 0; i < NUM_JOBS; i++) {
+		jobs[i] = (struct job) {
+			.cost_us = PERIOD_US * load / 100U * job_share[i] / 100U,
+		};
+		k_work_init(&jobs[i].work, job_handler);
+	}
+
+	k_work_queue_deadline_stats_reset(&work_q);
+
+	k_timer_start(&release_timer, K_USEC(PERIOD_US), K_USEC(PERIOD_US));
+	k_sleep(K_USEC((uint64_t)PERIOD_US * CONFIG_BENCHMARK_NUM_PERIODS));
+	k_timer_stop(&release_timer);
+	(void)k_work_queue_drain(&work_q, false);
+
+	/* Lost releases are missed deadlines too */
+	for (int i = 0; i < NUM_JOBS; i++) {
+		missed += jobs[i].missed + jobs[i].overruns;
+		completed += jobs[i].completed + jobs[i].overruns;
+		run += jobs[i].completed;
+	}
+
+	report_stats(use_deadline ? "edf" : "fifo", "urgent", load,
+		     jobs[URGENT].missed + jobs[URGENT].overruns,
+		     jobs[URGENT].completed + jobs[URGENT].overruns);
+	report_stats(use_deadline ? "edf" : "fifo", "all", load, missed, completed);
+
+	/* The work queue accounts for the same items */
+	k_work_queue_deadline_stats_get(&work_q, &stats);
+	if (use_deadline && (stats.completed != run)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "bench_wq",
+	};
+	int ret = 0;
+
+	printk("Deadline miss rates of periodic work items\n");
+	printk("Period: %u us, %u periods per load\n", PERIOD_US, CONFIG_BENCHMARK_NUM_PERIODS);
+
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   K_PRIO_PREEMPT(1), &cfg);
+
+	for (int i = 0; (i < ARRAY_SIZE(loads)) && (ret == 0); i++) {
+		use_deadline = false;
+		ret = bench_load(loads[i]);
+
+		if (ret == 0) {
+			use_deadline = true;
+			ret = bench_load(loads[i]);
+		}
+	}
+
+	if (ret < 0) {
+		printk("Work queue deadline statistics do not match\n");
+	}
+
+	TC_END_REPORT(ret == 0 ? TC_PASS : TC_FAIL);
+
+	return 0;
+}
@@ -26,6 +26,7 @@ DEFINE_FAKE_VALUE_FUNC(int, k_work_submit_to_queue, struct k_work_q *, struct k_
 DEFINE_FAKE_VALUE_FUNC(int, k_work_reschedule, struct k_work_delayable *, k_timeout_t);
 DEFINE_FAKE_VALUE_FUNC(int, k_work_schedule, struct k_work_delayable *, k_timeout_t);
 DEFINE_FAKE_VALUE_FUNC(int, k_work_busy_get, const struct k_work *);
+DEFINE_FAKE_VALUE_FUNC(bool, k_work_queue_thread_is_current, struct k_work_q *);
 DEFINE_FAKE_VOID_FUNC(k_queue_init, struct k_queue *);
 DEFINE_FAKE_VOID_FUNC(k_queue_append, struct k_queue *, void *);
 DEFINE_FAKE_VALUE_FUNC(int, k_queue_is_empty, struct k_queue *);
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define ARENA_SIZE  256
+#define GROW_SIZE   64
+#define CHUNK_SIZE  256
+
+K_ARENA_DEFINE_STATIC(arena, ARENA_SIZE);
+K_HEAP_DEFINE(chunk_heap, 2048);
+
+static struct k_arena grow_arena;
+static char __aligned(sizeof(void *)) grow_buf[GROW_SIZE];
+
+static bool in_buffer(struct k_arena *a, void *p, size_t bytes)
+{
+	return ((char *)p >= a->buffer) && ((char *)p + bytes <= a->buffer + a->size);
+}
+
+static size_t heap_allocated(void)
+{
+	struct sys_memory_stats stats;
+
+	sys_heap_runtime_stats_get(&chunk_heap.heap, &stats);
+
+	return stats.allocated_bytes;
+}
+
+ZTEST(k_arena_api, test_arena_alloc)
+{
+	char *p1, *p2, *p3;
+
+	p1 = k_arena_aligned_alloc(&arena, 1, 3);
+	p2 = k_arena_aligned_alloc(&arena, 1, 5);
+	zassert_not_null(p1, "allocation failed");
+	zassert_equal_ptr(p2, p1 + 3, "allocations are not contiguous");
+
+	p3 = k_arena_alloc(&arena, 1);
+	zassert_true(IS_ALIGNED(p3, sizeof(void *)), "%p is not aligned", p3);
+	zassert_true(p3 >= p2 + 5, "allocations overlap");
+
+	p3 = k_arena_aligned_alloc(&arena, 64, 16);
+	zassert_true(IS_ALIGNED(p3, 64), "%p is not aligned", p3);
+
+	zassert_is_null(k_arena_alloc(&arena, 0), "zero bytes allocated");
+	zassert_is_null(k_arena_alloc(&arena, ARENA_SIZE), "arena overflowed");
+
+	/* What is left can still be allocated up to the last byte */
+	while (k_arena_aligned_alloc(&arena, 1, 1) != NULL) {
+	}
+
+	zassert_equal_ptr(arena.cur, arena.buffer + ARENA_SIZE, "arena not full");
+}
+
+ZTEST(k_arena_api, test_arena_reset)
+{
+	void *p1, *p2;
+
+	p1 = k_arena_alloc(&arena, 100);
+	zassert_not_null(k_arena_alloc(&arena, 100), "allocation failed");
+	zassert_is_null(k_arena_alloc(&arena, 100), "arena overflowed");
+
+	k_arena_reset(&arena);
+
+	/* All the memory is back at once */
+	p2 = k_arena_alloc(&arena, ARENA_SIZE);
+	zassert_equal_ptr(p1, p2, "arena not reset");
+}
+
+ZTEST(k_arena_api, test_arena_chunks)
+{
+	char *p1, *p2, *p3;
+
+	zassert_equal(heap_allocated(), 0, "heap not empty");
+
+	p1 = k_arena_alloc(&grow_arena, 48);
+	zassert_true(in_buffer(&grow_arena, p1, 48), "not allocated from the buffer");
+	zassert_equal(heap_allocated(), 0, "heap used too early");
+
+	/* The buffer is exhausted, a chunk is taken from the heap */
+	p2 = k_arena_alloc(&grow_arena, 48);
+	zassert_not_null(p2, "allocation failed");
+	zassert_false(in_buffer(&grow_arena, p2, 48), "allocated from the buffer");
+	zassert_true(heap_allocated() >= CHUNK_SIZE, "no chunk allocated");
+
+	/* Allocations larger than a chunk get their own chunk */
+	p3 = k_arena_alloc(&grow_arena, 2 * CHUNK_SIZE);
+	zassert_not_null(p3, "allocation failed");
+	memset(p3, 0xa5, 2 * CHUNK_SIZE);
+	zassert_true(heap_allocated() >= 3 * CHUNK_SIZE, "no large chunk allocated");
+
+	/* More than the heap can hold */
+	zassert_is_null(k_arena_alloc(&grow_arena, 4096), "heap overflowed");
+
+	k_arena_reset(&grow_arena);
+	zassert_equal(heap_allocated(), 0, "chunks not freed");
+
+	p2 = k_arena_alloc(&grow_arena, 48);
+	zassert_equal_ptr(p1, p2, "arena not reset");
+}
+
+ZTEST(k_arena_api, test_arena_no_heap)
+{
+	k_arena_heap_set(&grow_arena, NULL, 0);
+
+	zassert_not_null(k_arena_alloc(&grow_arena, GROW_SIZE), "allocation failed");
+	zassert_is_null(k_arena_alloc(&grow_arena, 1), "arena grew without a heap");
+	zassert_equal(heap_allocated(), 0, "heap used");
+}
+
+ZTEST(k_arena_api, test_arena_stats)
+{
+	struct sys_memory_stats stats;
+
+	zassert_equal(k_arena_runtime_stats_get(&arena, &stats), 0, "no stats");
+	zassert_equal(stats.allocated_bytes, 0, "arena not empty");
+	zassert_equal(stats.free_bytes, ARENA_SIZE, "wrong free bytes");
+
+	k_arena_aligned_alloc(&arena, 1, 10);
+	k_arena_aligned_alloc(&arena, 16, 10);
+
+	k_arena_runtime_stats_get(&arena, &stats);
+	zassert_true(stats.allocated_bytes >= 20, "wrong allocated bytes");
+	zassert_equal(stats.allocated_bytes + stats.free_bytes, ARENA_SIZE,
+		      "bytes missing");
+	zassert_equal(stats.max_allocated_bytes, stats.allocated_bytes, "wrong maximum");
+
+	k_arena_reset(&arena);
+
+	k_arena_runtime_stats_get(&arena, &stats);
+	zassert_equal(stats.allocated_bytes, 0, "arena not reset");
+	zassert_true(stats.max_allocated_bytes >= 20, "maximum lost");
+
+	k_arena_runtime_stats_reset_max(&arena);
+	k_arena_runtime_stats_get(&arena, &stats);
+	zassert_equal(stats.max_allocated_bytes, 0, "maximum not reset");
+
+#ifdef CONFIG_OBJ_CORE_STATS_ARENA
+	struct sys_memory_stats obj_stats;
+
+	k_arena_alloc(&arena, 32);
+	k_arena_runtime_stats_get(&arena, &stats);
+
+	zassert_equal(k_obj_core_stats_raw(K_OBJ_CORE(&arena), &obj_stats,
+					   sizeof(obj_stats)), 0, "no raw stats");
+	zassert_mem_equal(&stats, &obj_stats, sizeof(stats), "raw stats differ");
+
+	zassert_equal(k_obj_core_stats_query(K_OBJ_CORE(&arena), &obj_stats,
+					     sizeof(obj_stats)), 0, "no query stats");
+	zassert_mem_equal(&stats, &obj_stats, sizeof(stats), "query stats differ");
+#endif /* CONFIG_OBJ_CORE_STATS_ARENA */
+}
+
+static void isr_alloc(const void *arg)
+{
+	void **p = (void **)arg;
+
+	*p = k_arena_alloc(&arena, 16);
+}
+
+ZTEST(k_arena_api, test_arena_isr)
+{
+	void *p = NULL;
+
+	irq_offload(isr_alloc, &p);
+
+	zassert_true(in_buffer(&arena, p, 16), "allocation from ISR failed");
+}
+
+static void *arena_setup(void)
+{
+	/* Initialized once, the arenas are linked to the object core lists */
+	k_arena_init(&grow_arena, grow_buf, sizeof(grow_buf));
+
+	return NULL;
+}
+
+static void arena_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_arena_reset(&arena);
+	k_arena_runtime_stats_reset_max(&arena);
+
+	k_arena_reset(&grow_arena);
+	k_arena_heap_set(&grow_arena, &chunk_heap, CHUNK_SIZE);
+}
+
+ZTEST_SUITE(k_arena_api, NULL, arena_setup, arena_before, NULL, NULL);
@@ -693,6 +693,88 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+#ifdef CONFIG_OBJ_CORE_STATS_SCHED
+/***************** SCHEDULER HISTOGRAMS ******************/
+
+static int sched_obj_core_get(struct k_obj_core *obj_core, void *data)
+{
+	*(struct k_obj_core **)data = obj_core;
+
+	return 1;
+}
+
+static uint32_t hist_bucket_sum(const struct k_sched_histogram *hist)
+{
+	uint32_t sum = 0;
+
+	for (unsigned int i = 0; i < K_SCHED_HISTOGRAM_BUCKETS; i++) {
+		sum += hist->buckets[i];
+	}
+
+	return sum;
+}
+
+ZTEST(obj_core_stats_sched, test_obj_core_stats_sched)
+{
+	struct k_obj_type *type = k_obj_type_find(K_OBJ_TYPE_SCHED_ID);
+	struct k_obj_core *obj_core = NULL;
+	struct k_sched_histograms raw[CONFIG_MP_MAX_NUM_CPUS];
+	struct k_sched_histograms query;
+	unsigned int key;
+	int status;
+
+	zassert_not_null(type, "Scheduler object type not found");
+	k_obj_type_walk_locked(type, sched_obj_core_get, &obj_core);
+	zassert_not_null(obj_core, "Scheduler object not found");
+
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	/* Each sleep switches to the idle thread, and the timer ISR makes
+	 * this thread ready again.
+	 */
+	for (unsigned int i = 0; i < 10; i++) {
+		k_msleep(1);
+	}
+
+	/* Keep the histograms of this CPU from changing while checked */
+	key = irq_lock();
+	status = k_obj_core_stats_raw(obj_core, raw, sizeof(raw));
+	irq_unlock(key);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		zassert_equal(hist_bucket_sum(&raw[i].runq_wait), raw[i].runq_wait.count);
+		zassert_equal(hist_bucket_sum(&raw[i].switch_latency),
+			      raw[i].switch_latency.count);
+		zassert_equal(hist_bucket_sum(&raw[i].isr_wake), raw[i].isr_wake.count);
+		zassert_true(raw[i].runq_wait.total >= raw[i].runq_wait.max);
+	}
+
+	status = k_obj_core_stats_query(obj_core, &query, sizeof(query));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	zassert_true(query.runq_wait.count >= 10, "%u run queue waits",
+		     query.runq_wait.count);
+	zassert_true(query.switch_latency.count >= 10, "%u context switches",
+		     query.switch_latency.count);
+	zassert_true(query.isr_wake.count >= 10, "%u ISR wakeups", query.isr_wake.count);
+	zassert_true(query.lock_hold.count > 0, "scheduler lock never held");
+
+	/* Samples recorded after the reset are not enough to catch up */
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_obj_core_stats_query(obj_core, &query, sizeof(query));
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	zassert_true(query.runq_wait.count < 10, "%u run queue waits after reset",
+		     query.runq_wait.count);
+}
+
+ZTEST_SUITE(obj_core_stats_sched, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+#endif /* CONFIG_OBJ_CORE_STATS_SCHED */
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
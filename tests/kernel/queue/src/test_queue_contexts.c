@@ -553,3 +553,32 @@ ZTEST(queue_api, test_queue_unique_append)
 	ret = k_queue_unique_append(&queue, (void *)&data[1]);
 	zassert_true(ret, "queue unique append failed");
 }
+
+/**
+ * @brief Test getting several items from a queue at once
+ *
+ * @details Append three items to a queue and get them in batches of two,
+ * verifying that the items come out in order and that a batch stops at
+ * the end of the queue.
+ *
+ * @see k_queue_get_bulk()
+ */
+ZTEST(queue_api, test_queue_get_bulk)
+{
+	void *items[LIST_LEN];
+
+	k_queue_init(&queue);
+	k_queue_append(&queue, (void *)&data[0]);
+	k_queue_append(&queue, (void *)&data[1]);
+	k_queue_append(&queue, (void *)&data_p[0]);
+
+	zassert_equal(k_queue_get_bulk(&queue, items, LIST_LEN), LIST_LEN);
+	zassert_equal(items[0], &data[0]);
+	zassert_equal(items[1], &data[1]);
+
+	zassert_equal(k_queue_get_bulk(&queue, items, LIST_LEN), 1);
+	zassert_equal(items[0], &data_p[0]);
+
+	zassert_equal(k_queue_get_bulk(&queue, items, LIST_LEN), 0);
+	zassert_true(k_queue_is_empty(&queue));
+}
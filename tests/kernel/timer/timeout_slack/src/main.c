@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define ALIGN_TICKS 64
+
+static struct k_timer timers[3];
+
+/* A tick aligned on ALIGN_TICKS, far enough in the future for the timers
+ * to be started before it.
+ */
+static k_ticks_t aligned_tick_get(void)
+{
+	return ROUND_UP(k_uptime_ticks() + 2 * ALIGN_TICKS, ALIGN_TICKS);
+}
+
+ZTEST(timeout_slack, test_timer_slack_window)
+{
+	struct k_timer *timer = &timers[0];
+	k_ticks_t start;
+	k_ticks_t expiry;
+
+	k_timer_init(timer, NULL, NULL);
+	k_timer_slack_set(timer, K_TICKS(ALIGN_TICKS));
+
+	start = k_uptime_ticks();
+	k_timer_start(timer, K_TICKS(100), K_NO_WAIT);
+	expiry = k_timer_expires_ticks(timer);
+
+	zassert_true(expiry >= start + 100, "timer expires early");
+	zassert_true(expiry <= start + 100 + ALIGN_TICKS + 2, "timer expires too late");
+	zassert_equal(expiry % ALIGN_TICKS, 0, "expiry %lld not aligned",
+		      (long long)expiry);
+
+	k_timer_status_sync(timer);
+	zassert_true(k_uptime_ticks() >= expiry, "timer expired early");
+
+	k_timer_slack_set(timer, K_NO_WAIT);
+}
+
+ZTEST(timeout_slack, test_timers_coalesced)
+{
+	struct sys_clock_timeout_stats before;
+	struct sys_clock_timeout_stats after;
+	k_ticks_t target = aligned_tick_get();
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		k_timer_init(timer, NULL, NULL);
+	}
+
+	/* Every window contains the target tick and no other tick with as
+	 * many trailing zero bits, so that the timers all expire on it.
+	 */
+	k_timer_slack_set(&timers[1], K_TICKS(ALIGN_TICKS / 2));
+	k_timer_slack_set(&timers[2], K_TICKS(ALIGN_TICKS / 4));
+
+	sys_clock_timeout_stats_get(&before);
+
+	k_timer_start(&timers[0], K_TIMEOUT_ABS_TICKS(target), K_NO_WAIT);
+	k_timer_start(&timers[1], K_TIMEOUT_ABS_TICKS(target - ALIGN_TICKS / 4), K_NO_WAIT);
+	k_timer_start(&timers[2], K_TIMEOUT_ABS_TICKS(target - 5), K_NO_WAIT);
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		zassert_equal(k_timer_expires_ticks(timer), target,
+			      "timer %u not moved to the aligned tick",
+			      (unsigned int)(timer - timers));
+	}
+
+	ARRAY_FOR_EACH_PTR(timers, timer) {
+		k_timer_status_sync(timer);
+	}
+
+	sys_clock_timeout_stats_get(&after);
+
+	zassert_true(after.expired - before.expired >= ARRAY_SIZE(timers));
+	zassert_true(after.coalesced - before.coalesced >= ARRAY_SIZE(timers) - 1);
+	zassert_true(after.deferred - before.deferred >= ARRAY_SIZE(timers) - 1);
+}
+
+ZTEST(timeout_slack, test_thread_sleep_slack)
+{
+	k_ticks_t start;
+	k_ticks_t elapsed;
+
+	k_thread_timeout_slack_set(k_current_get(), K_TICKS(ALIGN_TICKS));
+
+	start = k_uptime_ticks();
+	k_sleep(K_TICKS(100));
+	elapsed = k_uptime_ticks() - start;
+
+	k_thread_timeout_slack_set(k_current_get(), K_NO_WAIT);
+
+	zassert_true(elapsed >= 100, "slept %lld ticks only", (long long)elapsed);
+	zassert_true(elapsed <= 100 + ALIGN_TICKS + 2, "slept %lld ticks", (long long)elapsed);
+}
+
+ZTEST_SUITE(timeout_slack, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_ITEMS  5
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(work_q_stack, STACK_SIZE);
+static struct k_work_q work_q;
+
+static K_SEM_DEFINE(release_sem, 0, 1);
+static struct k_work blocker;
+static bool blocked;
+
+static struct k_work items[NUM_ITEMS];
+static int order[NUM_ITEMS];
+static int num_run;
+static int32_t thread_deadline;
+
+static void block_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	blocked = true;
+	k_sem_take(&release_sem, K_FOREVER);
+}
+
+static void record_handler(struct k_work *work)
+{
+	order[num_run++] = work - items;
+	thread_deadline = k_current_get()->base.prio_deadline - (int32_t)k_cycle_get_32();
+}
+
+static void late_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(200);
+}
+
+/* Hold the queue so that the next submissions are all pending */
+static void queue_block(void)
+{
+	blocked = false;
+	k_work_init(&blocker, block_handler);
+	zassert_equal(k_work_submit_to_queue(&work_q, &blocker), 1, "submission failed");
+
+	for (int i = 0; !blocked && (i < 100); i++) {
+		k_msleep(1);
+	}
+	zassert_true(blocked, "queue not blocked");
+}
+
+static void queue_release(void)
+{
+	k_sem_give(&release_sem);
+	zassert_true(k_work_queue_drain(&work_q, false) >= 0, "drain failed");
+}
+
+ZTEST(workqueue_deadline, test_deadline_order)
+{
+	static const int32_t deadline_ms[NUM_ITEMS] = { -1, 3000, 1000, -1, 2000 };
+	static const int expected[NUM_ITEMS] = { 2, 4, 1, 0, 3 };
+
+	queue_block();
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], record_handler);
+
+		if (deadline_ms[i] < 0) {
+			zassert_equal(k_work_submit_to_queue(&work_q, &items[i]), 1,
+				      "submission failed");
+		} else {
+			zassert_equal(k_work_submit_with_deadline(&work_q, &items[i],
+								  k_ms_to_cyc_ceil32(deadline_ms[i])),
+				      1, "submission failed");
+		}
+	}
+
+	queue_release();
+
+	zassert_equal(num_run, NUM_ITEMS, "items not run");
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(order[i], expected[i], "item %d run at position %d", order[i], i);
+	}
+}
+
+ZTEST(workqueue_deadline, test_deadline_thread)
+{
+	int32_t deadline = k_ms_to_cyc_ceil32(1000);
+
+	k_work_init(&items[0], record_handler);
+	zassert_equal(k_work_submit_with_deadline(&work_q, &items[0], deadline), 1,
+		      "submission failed");
+	zassert_true(k_work_queue_drain(&work_q, false) >= 0, "drain failed");
+
+	/* The work queue thread ran the item with its deadline */
+	zassert_true((thread_deadline > 0) && (thread_deadline <= deadline),
+		     "wrong thread deadline %d", thread_deadline);
+
+	/* A later submission without a deadline clears it */
+	zassert_equal(k_work_submit_to_queue(&work_q, &items[0]), 1, "submission failed");
+	zassert_true(k_work_queue_drain(&work_q, false) >= 0, "drain failed");
+	zassert_true(thread_deadline > deadline, "deadline kept %d", thread_deadline);
+}
+
+ZTEST(workqueue_deadline, test_deadline_stats)
+{
+	struct k_work_queue_deadline_stats stats;
+
+	k_work_queue_deadline_stats_reset(&work_q);
+
+	k_work_init(&items[0], late_handler);
+	k_work_init(&items[1], late_handler);
+	zassert_equal(k_work_submit_with_deadline(&work_q, &items[0], 0), 1,
+		      "submission failed");
+	zassert_equal(k_work_submit_with_deadline(&work_q, &items[1],
+						  k_ms_to_cyc_ceil32(1000)), 1,
+		      "submission failed");
+	zassert_true(k_work_queue_drain(&work_q, false) >= 0, "drain failed");
+
+	/* Items without a deadline are not accounted */
+	zassert_equal(k_work_submit_to_queue(&work_q, &items[0]), 1, "submission failed");
+	zassert_true(k_work_queue_drain(&work_q, false) >= 0, "drain failed");
+
+	k_work_queue_deadline_stats_get(&work_q, &stats);
+	zassert_equal(stats.completed, 2, "wrong completed count %u", stats.completed);
+	zassert_equal(stats.missed, 1, "wrong missed count %u", stats.missed);
+}
+
+static void *deadline_setup(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "deadline_wq",
+	};
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* A single worker keeps the run order predictable */
+	static struct k_work_q_worker worker;
+
+	k_work_queue_pool_start(&work_q, &worker, 1, work_q_stack, STACK_SIZE,
+				K_PRIO_PREEMPT(4), &cfg);
+#else
+	k_work_queue_start(&work_q, work_q_stack, K_THREAD_STACK_SIZEOF(work_q_stack),
+			   K_PRIO_PREEMPT(4), &cfg);
+#endif
+
+	return NULL;
+}
+
+static void deadline_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	num_run = 0;
+	memset(order, 0, sizeof(order));
+}
+
+ZTEST_SUITE(workqueue_deadline, NULL, deadline_setup, deadline_before, NULL, NULL);
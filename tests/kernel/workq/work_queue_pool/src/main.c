@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 3
+#define NUM_ITEMS   8
+#define WORK_MS     20
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[NUM_WORKERS];
+static struct k_work_q pool;
+
+static struct k_work items[NUM_ITEMS];
+static k_tid_t ran_on[NUM_ITEMS];
+static atomic_t active;
+static atomic_t max_active;
+
+static K_SEM_DEFINE(release_sem, 0, NUM_WORKERS);
+
+static void pool_start(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "pool_wq",
+		.pin_workers = true,
+	};
+
+	k_work_queue_pool_start(&pool, pool_workers, NUM_WORKERS, pool_stacks[0],
+				STACK_SIZE, K_PRIO_PREEMPT(4), &cfg);
+}
+
+static void active_enter(void)
+{
+	atomic_val_t n = atomic_inc(&active) + 1;
+	atomic_val_t max;
+
+	do {
+		max = atomic_get(&max_active);
+	} while ((n > max) && !atomic_cas(&max_active, max, n));
+}
+
+static void sleep_handler(struct k_work *work)
+{
+	active_enter();
+	ran_on[work - items] = k_current_get();
+	k_msleep(WORK_MS);
+	atomic_dec(&active);
+}
+
+static void block_handler(struct k_work *work)
+{
+	active_enter();
+	ran_on[work - items] = k_current_get();
+	k_sem_take(&release_sem, K_FOREVER);
+	atomic_dec(&active);
+}
+
+ZTEST(workqueue_pool, test_pool_steal)
+{
+	int num_threads = 0;
+
+	/* Submitted from a single CPU, the items all go to one worker */
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], sleep_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, "submission failed");
+	}
+
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_not_null(ran_on[i], "item %d not run", i);
+		zassert_equal(k_work_busy_get(&items[i]), 0, "item %d still busy", i);
+	}
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		for (int j = 0; j < NUM_ITEMS; j++) {
+			if (ran_on[j] == &pool_workers[i].thread) {
+				num_threads++;
+				break;
+			}
+		}
+	}
+
+	zassert_true(num_threads > 1, "no work stolen");
+	zassert_true(atomic_get(&max_active) > 1, "items not run concurrently");
+}
+
+static struct k_work self_work;
+static atomic_t self_runs;
+static atomic_t self_active;
+static bool self_overlap;
+static int self_ret;
+static int self_busy;
+
+static void self_handler(struct k_work *work)
+{
+	if (atomic_inc(&self_active) != 0) {
+		self_overlap = true;
+	}
+
+	if (atomic_inc(&self_runs) == 0) {
+		self_ret = k_work_submit_to_queue(&pool, work);
+		self_busy = k_work_busy_get(work);
+
+		/* The idle workers must leave the resubmitted item alone */
+		k_msleep(WORK_MS);
+	}
+
+	atomic_dec(&self_active);
+}
+
+ZTEST(workqueue_pool, test_pool_resubmit_running)
+{
+	k_work_init(&self_work, self_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &self_work), 1, "submission failed");
+
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+
+	zassert_equal(self_ret, 2, "not queued to the running worker");
+	zassert_equal(self_busy, K_WORK_RUNNING | K_WORK_QUEUED, "wrong busy state");
+	zassert_equal(atomic_get(&self_runs), 2, "wrong number of runs");
+	zassert_false(self_overlap, "handler run concurrently with itself");
+}
+
+ZTEST(workqueue_pool, test_pool_flush)
+{
+	struct k_work_sync sync;
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], sleep_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, "submission failed");
+	}
+
+	/* Queued behind the other items, possibly stolen with its flusher */
+	zassert_true(k_work_flush(&items[NUM_ITEMS - 1], &sync), "item not pending");
+	zassert_not_null(ran_on[NUM_ITEMS - 1], "flushed item not run");
+	zassert_equal(k_work_busy_get(&items[NUM_ITEMS - 1]), 0, "flushed item busy");
+
+	/* Running */
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1, "submission failed");
+	k_msleep(WORK_MS / 2);
+	zassert_true(k_work_flush(&items[0], &sync), "item not pending");
+	zassert_equal(k_work_busy_get(&items[0]), 0, "flushed item busy");
+
+	zassert_false(k_work_flush(&items[0], &sync), "idle item flushed");
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+}
+
+ZTEST(workqueue_pool, test_pool_cancel)
+{
+	struct k_work_sync sync;
+	struct k_work *victim = &items[NUM_WORKERS];
+
+	/* Keep all the workers busy */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_init(&items[i], block_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, "submission failed");
+	}
+
+	for (int i = 0; (atomic_get(&active) < NUM_WORKERS) && (i < 100); i++) {
+		k_msleep(1);
+	}
+	zassert_equal(atomic_get(&active), NUM_WORKERS, "workers not busy");
+
+	k_work_init(victim, sleep_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, victim), 1, "submission failed");
+	zassert_equal(k_work_busy_get(victim), K_WORK_QUEUED, "wrong busy state");
+
+	zassert_true(k_work_cancel_sync(victim, &sync), "queued item not pending");
+	zassert_equal(k_work_busy_get(victim), 0, "canceled item busy");
+
+	zassert_equal(k_work_cancel(&items[0]), K_WORK_RUNNING | K_WORK_CANCELING,
+		      "wrong busy state");
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), -EBUSY,
+		      "canceling item submitted");
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&release_sem);
+	}
+
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+	zassert_equal(k_work_busy_get(&items[0]), 0, "canceled item busy");
+	zassert_is_null(ran_on[NUM_WORKERS], "canceled item run");
+}
+
+static struct k_work chain_first;
+static struct k_work chain_second;
+static int chain_ret;
+static bool chain_ran;
+
+static void chain_first_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_msleep(WORK_MS);
+	chain_ret = k_work_submit_to_queue(&pool, &chain_second);
+}
+
+static void chain_second_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	chain_ran = true;
+}
+
+ZTEST(workqueue_pool, test_pool_drain_chained)
+{
+	struct k_work work;
+
+	k_work_init(&chain_first, chain_first_handler);
+	k_work_init(&chain_second, chain_second_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &chain_first), 1, "submission failed");
+
+	/* Submissions from the workers are accepted while draining */
+	zassert_equal(k_work_queue_drain(&pool, true), 1, "drain did not wait");
+	zassert_equal(chain_ret, 1, "chained submission rejected");
+	zassert_true(chain_ran, "chained item not run");
+
+	k_work_init(&work, sleep_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &work), -EBUSY, "plugged queue accepted work");
+	zassert_ok(k_work_queue_unplug(&pool), "unplug failed");
+}
+
+static bool on_pool[NUM_WORKERS];
+
+static void current_handler(struct k_work *work)
+{
+	on_pool[work - items] = k_work_queue_thread_is_current(&pool);
+	block_handler(work);
+}
+
+ZTEST(workqueue_pool, test_pool_thread_is_current)
+{
+	zassert_false(k_work_queue_thread_is_current(&pool), "test thread seen as a worker");
+
+	/* Keep all the workers busy, so that each runs one item */
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		on_pool[i] = false;
+		k_work_init(&items[i], current_handler);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i]), 1, "submission failed");
+	}
+
+	for (int i = 0; (atomic_get(&active) < NUM_WORKERS) && (i < 100); i++) {
+		k_msleep(1);
+	}
+	zassert_equal(atomic_get(&active), NUM_WORKERS, "workers not busy");
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_sem_give(&release_sem);
+	}
+
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_true(on_pool[i], "worker %d not recognized", i);
+	}
+}
+
+ZTEST(workqueue_pool, test_pool_stop)
+{
+	zassert_equal(k_work_queue_stop(&pool, K_FOREVER), -EBUSY, "stopped while not plugged");
+	zassert_true(k_work_queue_drain(&pool, true) >= 0, "drain failed");
+	zassert_ok(k_work_queue_stop(&pool, K_FOREVER), "stop failed");
+
+	k_work_init(&items[0], sleep_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), -ENODEV,
+		      "stopped queue accepted work");
+
+	/* The pool can be started again */
+	pool_start();
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0]), 1, "submission failed");
+	zassert_true(k_work_queue_drain(&pool, false) >= 0, "drain failed");
+	zassert_not_null(ran_on[0], "item not run");
+}
+
+ZTEST(workqueue_pool, test_pool_sysworkq)
+{
+	struct k_work_sync sync;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_SYSTEM_WORKQUEUE_POOL);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i], sleep_handler);
+		zassert_equal(k_work_submit(&items[i]), 1, "submission failed");
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_flush(&items[i], &sync);
+		zassert_not_null(ran_on[i], "item %d not run", i);
+	}
+
+	zassert_true(atomic_get(&max_active) > 1, "items not run concurrently");
+}
+
+static void *pool_setup(void)
+{
+	pool_start();
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(ran_on, 0, sizeof(ran_on));
+	atomic_clear(&active);
+	atomic_clear(&max_active);
+	k_sem_reset(&release_sem);
+}
+
+ZTEST_SUITE(workqueue_pool, NULL, pool_setup, pool_before, NULL, NULL);
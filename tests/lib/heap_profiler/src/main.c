@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/heap_profiler.h>
+
+#define HEAP_SZ   0x2000
+#define NUM_A     3
+#define SIZE_A    24
+#define NUM_B     5
+#define SIZE_B    40
+#define SIZE_K    32
+
+static uint8_t __aligned(8) heapmem[HEAP_SZ];
+static struct sys_heap heap;
+static void *blocks_a[NUM_A];
+static void *blocks_b[NUM_B];
+static char dump[1024];
+
+K_HEAP_DEFINE(kheap, 1024);
+
+static __noinline void alloc_a(void)
+{
+	for (int i = 0; i < NUM_A; i++) {
+		blocks_a[i] = sys_heap_alloc(&heap, SIZE_A);
+		zassert_not_null(blocks_a[i], "allocation failed");
+	}
+}
+
+static __noinline void alloc_b(void)
+{
+	for (int i = 0; i < NUM_B; i++) {
+		blocks_b[i] = sys_heap_aligned_alloc(&heap, 16, SIZE_B);
+		zassert_not_null(blocks_b[i], "allocation failed");
+	}
+}
+
+static __noinline void k_alloc_c(void **blocks, int num)
+{
+	for (int i = 0; i < num; i++) {
+		blocks[i] = k_malloc(SIZE_K);
+		zassert_not_null(blocks[i], "allocation failed");
+	}
+}
+
+static __noinline void k_alloc_d(void **blocks, int num)
+{
+	for (int i = 0; i < num; i++) {
+		blocks[i] = k_heap_alloc(&kheap, SIZE_K, K_NO_WAIT);
+		zassert_not_null(blocks[i], "allocation failed");
+	}
+}
+
+/* Site whose sampled allocations match the given count and size */
+static int site_find(uint32_t count, size_t bytes, struct sys_heap_profiler_site *site)
+{
+	for (unsigned int i = 0; i < CONFIG_SYS_HEAP_PROFILER_SITES; i++) {
+		if ((sys_heap_profiler_site_get(i, site) == 0) &&
+		    (site->alloc_count == count) && (site->alloc_bytes == count * bytes)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static size_t live_bytes(void)
+{
+	struct sys_heap_profiler_site site;
+	size_t bytes = 0;
+
+	for (unsigned int i = 0; i < CONFIG_SYS_HEAP_PROFILER_SITES; i++) {
+		if (sys_heap_profiler_site_get(i, &site) == 0) {
+			bytes += site.live_bytes;
+		}
+	}
+
+	return bytes;
+}
+
+ZTEST(lib_heap_profiler, test_profiler_sites)
+{
+	struct sys_heap_profiler_site site;
+	size_t base = live_bytes();
+	int a, b;
+
+	alloc_a();
+	alloc_b();
+
+	a = site_find(NUM_A, SIZE_A, &site);
+	zassert_true(a >= 0, "site of alloc_a() not found");
+	zassert_equal(site.live_count, NUM_A, "wrong live count");
+	zassert_equal(site.live_bytes, NUM_A * SIZE_A, "wrong live bytes");
+	zassert_true(site.depth >= 1, "no backtrace");
+
+	b = site_find(NUM_B, SIZE_B, &site);
+	zassert_true(b >= 0, "site of alloc_b() not found");
+	zassert_not_equal(a, b, "allocation sites merged");
+	zassert_equal(site.live_count, NUM_B, "wrong live count");
+
+	for (int i = 0; i < NUM_B; i++) {
+		sys_heap_free(&heap, blocks_b[i]);
+	}
+
+	/* The cumulative counts remain once the blocks are freed */
+	zassert_equal(sys_heap_profiler_site_get(b, &site), 0, "site released");
+	zassert_equal(site.live_count, 0, "freed blocks still live");
+	zassert_equal(site.live_bytes, 0, "freed bytes still live");
+	zassert_equal(site.alloc_count, NUM_B, "wrong allocation count");
+
+	for (int i = 0; i < NUM_A; i++) {
+		sys_heap_free(&heap, blocks_a[i]);
+	}
+
+	zassert_equal(live_bytes(), base, "bytes still live");
+	zassert_equal(sys_heap_profiler_dropped_get(), 0, "samples dropped");
+}
+
+ZTEST(lib_heap_profiler, test_profiler_kernel_callers)
+{
+	struct sys_heap_profiler_site site;
+	void *blocks[5];
+	int c, d;
+
+	/* k_malloc() and k_heap_alloc() charge their callers, not the
+	 * kernel helpers, and k_malloc() adds its heap reference.
+	 */
+	k_alloc_c(&blocks[0], 2);
+	k_alloc_d(&blocks[2], 3);
+
+	c = site_find(2, SIZE_K + sizeof(void *), &site);
+	zassert_true(c >= 0, "site of k_alloc_c() not found");
+
+	d = site_find(3, SIZE_K, &site);
+	zassert_true(d >= 0, "site of k_alloc_d() not found");
+
+	k_free(blocks[0]);
+	k_free(blocks[1]);
+
+	for (int i = 2; i < ARRAY_SIZE(blocks); i++) {
+		k_heap_free(&kheap, blocks[i]);
+	}
+}
+
+ZTEST(lib_heap_profiler, test_profiler_realloc)
+{
+	size_t base = live_bytes();
+	void *p1, *p2;
+
+	/* Other heaps may be in use, only the changes are checked */
+	p1 = sys_heap_alloc(&heap, 16);
+	zassert_equal(live_bytes(), base + 16, "allocation not sampled");
+
+	/* Whether in place or moved, the live bytes follow the block */
+	p2 = sys_heap_realloc(&heap, p1, 200);
+	zassert_not_null(p2, "realloc failed");
+	zassert_equal(live_bytes(), base + 200, "realloc not accounted");
+
+	p1 = sys_heap_alloc(&heap, 64);
+	p2 = sys_heap_realloc(&heap, p2, 2000);
+	zassert_not_null(p2, "realloc failed");
+	zassert_equal(live_bytes(), base + 64 + 2000, "realloc not accounted");
+
+	sys_heap_free(&heap, p1);
+	zassert_is_null(sys_heap_realloc(&heap, p2, 0), "realloc to zero bytes");
+	zassert_equal(live_bytes(), base, "bytes still live");
+}
+
+ZTEST(lib_heap_profiler, test_profiler_reset)
+{
+	struct sys_heap_profiler_site site;
+	int a, b;
+
+	alloc_a();
+	alloc_b();
+
+	a = site_find(NUM_A, SIZE_A, &site);
+	b = site_find(NUM_B, SIZE_B, &site);
+	zassert_true((a >= 0) && (b >= 0), "sites not found");
+
+	for (int i = 0; i < NUM_B; i++) {
+		sys_heap_free(&heap, blocks_b[i]);
+	}
+
+	sys_heap_profiler_reset();
+
+	/* Sites with live blocks are kept, the other ones released */
+	zassert_equal(sys_heap_profiler_site_get(a, &site), 0, "live site released");
+	zassert_equal(site.live_count, NUM_A, "live blocks lost");
+	zassert_equal(site.alloc_count, 0, "allocation count not reset");
+	zassert_equal(sys_heap_profiler_site_get(b, &site), -ENOENT, "site not released");
+
+	for (int i = 0; i < NUM_A; i++) {
+		sys_heap_free(&heap, blocks_a[i]);
+	}
+}
+
+ZTEST(lib_heap_profiler, test_profiler_dump)
+{
+	size_t len;
+	char *line;
+
+	alloc_a();
+
+	len = sys_heap_profiler_dump_buf(dump, sizeof(dump));
+	zassert_equal(len, strlen(dump), "wrong length");
+	zassert_equal(strncmp(dump, "heap profile: ", 14), 0, "no header");
+	zassert_not_null(strstr(dump, "@ heapprofile\n"), "wrong header");
+
+	line = strstr(dump, "3: 72 [3: 72] @ 0x");
+	zassert_not_null(line, "site of alloc_a() not dumped:\n%s", dump);
+
+	/* Only whole lines are written */
+	len = sys_heap_profiler_dump_buf(dump, 8);
+	zassert_equal(len, 0, "truncated line written");
+	zassert_equal(dump[0], '\0', "buffer not terminated");
+
+	for (int i = 0; i < NUM_A; i++) {
+		sys_heap_free(&heap, blocks_a[i]);
+	}
+}
+
+static void profiler_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_heap_init(&heap, heapmem, HEAP_SZ);
+	sys_heap_profiler_reset();
+}
+
+ZTEST_SUITE(lib_heap_profiler, NULL, NULL, profiler_before, NULL, NULL);
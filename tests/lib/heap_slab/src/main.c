@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sys_heap.h>
+
+/* need to peek into some heap internals */
+#include "../../../../lib/heap/heap.h"
+
+#define HEAP_SZ    0x4000
+#define MAX_BLOCKS (HEAP_SZ / SLAB_ALIGN)
+
+uint8_t __aligned(CHUNK_UNIT) heapmem[HEAP_SZ];
+uint8_t scratchmem[HEAP_SZ / 2];
+
+static struct sys_heap heap;
+static void *blocks[MAX_BLOCKS];
+
+static void *slab_test_alloc(void *arg, size_t bytes)
+{
+	void *ret = sys_heap_alloc(arg, bytes);
+
+	if (ret != NULL) {
+		memset(ret, 0xa5, bytes);
+	}
+
+	zassert_true(sys_heap_validate(arg), "invalid heap");
+	return ret;
+}
+
+static void slab_test_free(void *arg, void *p)
+{
+	sys_heap_free(arg, p);
+	zassert_true(sys_heap_validate(arg), "invalid heap");
+}
+
+static void slab_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sys_heap_init(&heap, heapmem, HEAP_SZ);
+}
+
+/* Slots are aligned and hold at least the requested size, rounded up to
+ * the next size class only.
+ */
+ZTEST(lib_heap_slab, test_slab_size_classes)
+{
+	for (size_t bytes = 1; bytes <= CONFIG_SYS_HEAP_SLAB_MAX_SIZE; bytes++) {
+		void *p = sys_heap_alloc(&heap, bytes);
+		size_t usable;
+
+		zassert_not_null(p, "allocation of %zu bytes failed", bytes);
+		zassert_true(IS_ALIGNED(p, SLAB_ALIGN), "slot %p is not aligned", p);
+
+		usable = sys_heap_usable_size(&heap, p);
+		zassert_equal(usable, ROUND_UP(bytes + CHUNK_UNIT, SLAB_ALIGN) - CHUNK_UNIT,
+			      "wrong usable size %zu for %zu bytes", usable, bytes);
+
+		memset(p, 0x5a, usable);
+		zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+		sys_heap_free(&heap, p);
+		zassert_true(sys_heap_validate(&heap), "invalid heap");
+	}
+}
+
+ZTEST(lib_heap_slab, test_slab_reuse)
+{
+	void *p1, *p2;
+
+	p1 = sys_heap_alloc(&heap, 20);
+	sys_heap_free(&heap, p1);
+
+	/* Same size class, the freed slot is handed out again */
+	p2 = sys_heap_alloc(&heap, 24);
+	zassert_equal_ptr(p1, p2, "slot %p not reused, got %p", p1, p2);
+
+	/* Aligned allocations up to the slot alignment use the slots too */
+	p1 = sys_heap_aligned_alloc(&heap, SLAB_ALIGN, 24);
+	zassert_true(IS_ALIGNED(p1, SLAB_ALIGN), "slot %p is not aligned", p1);
+	zassert_equal(sys_heap_usable_size(&heap, p1), 24, "not a slot");
+
+	sys_heap_free(&heap, p2);
+	sys_heap_free(&heap, p1);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+}
+
+ZTEST(lib_heap_slab, test_slab_realloc)
+{
+	uint8_t *p1, *p2;
+
+	p1 = sys_heap_alloc(&heap, 20);
+	for (int i = 0; i < 20; i++) {
+		p1[i] = i;
+	}
+
+	/* Growing within the slot keeps it in place */
+	p2 = sys_heap_realloc(&heap, p1, 24);
+	zassert_equal_ptr(p1, p2, "realloc within the slot moved %p", p1);
+
+	/* Growing out of the slot moves the data */
+	p2 = sys_heap_realloc(&heap, p1, CONFIG_SYS_HEAP_SLAB_MAX_SIZE + 1);
+	zassert_not_null(p2, "realloc failed");
+	zassert_not_equal(p1, p2, "realloc out of the slot did not move %p", p1);
+	for (int i = 0; i < 20; i++) {
+		zassert_equal(p2[i], i, "data changed");
+	}
+
+	p1 = sys_heap_realloc(&heap, p2, 8);
+	zassert_not_null(p1, "realloc failed");
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(p1[i], i, "data changed");
+	}
+
+	sys_heap_free(&heap, p1);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+}
+
+/* The empty runs kept by the size classes are given back to the heap
+ * when a regular allocation would fail otherwise.
+ */
+ZTEST(lib_heap_slab, test_slab_reclaim)
+{
+	struct sys_memory_stats stats;
+	unsigned int n = 0;
+	void *big;
+
+	for (size_t bytes = 8; n < MAX_BLOCKS; bytes = bytes % 64 + 8) {
+		blocks[n] = sys_heap_alloc(&heap, bytes);
+		if (blocks[n] == NULL) {
+			break;
+		}
+		n++;
+	}
+
+	zassert_true(n > 0 && n < MAX_BLOCKS, "unexpected number of blocks %u", n);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	while (n > 0) {
+		sys_heap_free(&heap, blocks[--n]);
+	}
+
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	big = sys_heap_alloc(&heap, HEAP_SZ * 3 / 4);
+	zassert_not_null(big, "runs not reclaimed");
+	sys_heap_free(&heap, big);
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	zassert_equal(stats.allocated_bytes, 0, "%zu bytes still allocated",
+		      stats.allocated_bytes);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+}
+
+ZTEST(lib_heap_slab, test_slab_stress)
+{
+	struct z_heap_stress_result result;
+
+	sys_heap_stress(slab_test_alloc, slab_test_free, &heap,
+			HEAP_SZ, 2 * HEAP_SZ,
+			scratchmem, sizeof(scratchmem),
+			80, &result);
+
+	zassert_true(result.successful_allocs > 0, "no successful allocation");
+	TC_PRINT("successful allocs: %u/%u, frees: %u\n", result.successful_allocs,
+		 result.total_allocs, result.total_frees);
+}
+
+ZTEST_SUITE(lib_heap_slab, NULL, NULL, slab_before, NULL, NULL);
@@ -189,6 +189,39 @@ ZTEST(c_lib_dynamic_memalloc, test_malloc)
 	iptr = NULL;
 }
 
+#ifdef CONFIG_COMMON_LIBC_MALLOC_CACHE
+/**
+ * @brief Test the per-CPU caches of small blocks
+ *
+ * @see malloc(), free()
+ */
+ZTEST(c_lib_dynamic_memalloc, test_malloc_cache)
+{
+	void *ptr[CONFIG_COMMON_LIBC_MALLOC_CACHE_DEPTH * 2];
+	void *again;
+
+	/* A freed block is handed out again for its size class */
+	ptr[0] = malloc(20);
+	zassert_not_null(ptr[0], "malloc failed, errno: %d", errno);
+	free(ptr[0]);
+
+	again = malloc(24);
+	zassert_equal_ptr(ptr[0], again, "cached block not reused");
+	free(again);
+
+	/* Overflowing a cache gives blocks back to the heap */
+	for (size_t i = 0; i < ARRAY_SIZE(ptr); i++) {
+		ptr[i] = malloc(CONFIG_COMMON_LIBC_MALLOC_CACHE_MAX_SIZE);
+		zassert_not_null(ptr[i], "malloc failed, errno: %d", errno);
+		memset(ptr[i], 'p', CONFIG_COMMON_LIBC_MALLOC_CACHE_MAX_SIZE);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(ptr); i++) {
+		free(ptr[i]);
+	}
+}
+#endif /* CONFIG_COMMON_LIBC_MALLOC_CACHE */
+
 /**
  * @brief Test dynamic memory allocation free function
  *
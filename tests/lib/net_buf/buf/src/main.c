@@ -78,6 +78,7 @@ static void var_destroy_aligned_small(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE(bulk_pool, 8, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
 
 /* Two pools, one with aligned to 8 bytes and one with aligned to 4 bytes
  * buffers. The aligned pools are used to test that the alignment works
@@ -569,6 +570,66 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_bulk)
+{
+	struct net_buf *bufs[10];
+	size_t count;
+
+	count = net_buf_alloc_bulk(&bulk_pool, 20, bufs, 5, K_NO_WAIT);
+	zassert_equal(count, 5, "Failed to get buffers");
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(bufs[i]->size, FIXED_BUFFER_SIZE, "Invalid fixed buffer size");
+		zassert_equal(bufs[i]->len, 0, "Invalid fixed buffer length");
+		zassert_equal(bufs[i]->ref, 1, "Invalid reference count");
+		zassert_is_null(bufs[i]->frags, "Unexpected fragments");
+	}
+
+	zassert_equal(atomic_get(&bulk_pool.avail_count), 3, "Invalid available count");
+
+	/* Fragments are released along with their parent */
+	net_buf_frag_add(bufs[0], bufs[1]);
+	net_buf_frag_add(bufs[0], bufs[2]);
+	bufs[1] = bufs[3];
+	bufs[2] = NULL;
+	bufs[3] = net_buf_ref(bufs[4]);
+	bufs[4] = NULL;
+
+	net_buf_unref_chain_bulk(bufs, 5);
+	zassert_equal(atomic_get(&bulk_pool.avail_count), 7, "Invalid available count");
+
+	net_buf_unref_chain_bulk(&bufs[3], 1);
+	zassert_equal(atomic_get(&bulk_pool.avail_count), 8, "Invalid available count");
+
+	/* Only as many buffers as the pool holds are allocated */
+	count = net_buf_alloc_bulk(&bulk_pool, 20, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, 8, "Failed to get buffers");
+	zassert_equal(net_buf_alloc_bulk(&bulk_pool, 20, &bufs[8], 2, K_NO_WAIT), 0,
+		      "Got buffers from an empty pool");
+
+	net_buf_unref_chain_bulk(bufs, count);
+	zassert_equal(atomic_get(&bulk_pool.avail_count), 8, "Invalid available count");
+}
+
+ZTEST(net_buf_tests, test_net_buf_bulk_destroy)
+{
+	struct net_buf *bufs[3];
+	size_t count;
+
+	destroy_called = 0;
+
+	count = net_buf_alloc_bulk(&var_pool, 200, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, ARRAY_SIZE(bufs), "Failed to get buffers");
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_true(bufs[i]->size >= 200, "Invalid buffer size");
+	}
+
+	net_buf_unref_chain_bulk(bufs, count);
+
+	zassert_equal(destroy_called, ARRAY_SIZE(bufs), "Incorrect destroy callback count");
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
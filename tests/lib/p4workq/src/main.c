@@ -274,5 +274,42 @@ ZTEST(lib_p4wq_1cpu, test_p4wq_simple)
 	zassert_true(has_run, "high-priority item didn't run");
 }
 
+static void late_handler(struct k_p4wq_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_busy_wait(100);
+}
+
+/* Items completing after their deadline are counted, those without a
+ * deadline are not.
+ */
+ZTEST(lib_p4wq_1cpu, test_p4wq_deadline_stats)
+{
+	struct k_work_queue_deadline_stats stats;
+	int prio = 2;
+
+	k_thread_priority_set(k_current_get(), prio);
+	k_p4wq_deadline_stats_reset(&wq);
+
+	simple_item.priority = prio + 1;
+	simple_item.deadline = k_ms_to_cyc_ceil32(1000);
+	simple_item.handler = late_handler;
+	k_p4wq_submit(&wq, &simple_item);
+	k_msleep(10);
+
+	simple_item.deadline = 1;
+	k_p4wq_submit(&wq, &simple_item);
+	k_msleep(10);
+
+	simple_item.deadline = 0;
+	k_p4wq_submit(&wq, &simple_item);
+	k_msleep(10);
+
+	k_p4wq_deadline_stats_get(&wq, &stats);
+	zassert_equal(stats.completed, 2, "wrong completed count: %u", stats.completed);
+	zassert_equal(stats.missed, 1, "wrong missed count: %u", stats.missed);
+}
+
 ZTEST_SUITE(lib_p4wq, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(lib_p4wq_1cpu, NULL, NULL, ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
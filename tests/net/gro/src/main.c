@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_GRO_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+
+#include "connection.h"
+#include "ipv4.h"
+#include "net_private.h"
+
+#define TEST_PORT 9999
+
+/* Segments are sent to this port */
+#define GRO_PORT 4242
+#define GRO_SEQ 5000
+#define GRO_ACK 7000
+#define GRO_WND 8192
+
+#define TCP_FIN BIT(0)
+#define TCP_PSH BIT(3)
+#define TCP_ACK BIT(4)
+
+#define WAIT_TIME K_MSEC(100)
+
+static uint8_t test_data[1000];
+static uint8_t verify_buf[sizeof(test_data)];
+
+static struct net_in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+static struct net_in_addr in4addr_peer = { { { 192, 0, 2, 2 } } };
+
+static struct net_if *test_iface;
+
+static K_SEM_DEFINE(wait_data, 0, UINT_MAX);
+
+struct eth_context {
+	uint8_t mac_addr[6];
+};
+
+static struct eth_context eth_context;
+
+/* Segment given to the RX queue */
+struct gro_test_seg {
+	uint16_t port;
+	uint16_t offset;
+	uint16_t len;
+	uint32_t ack;
+	uint16_t wnd;
+	uint8_t flags;
+};
+
+/* Packet processed by TCP, merged or not */
+struct gro_test_rx {
+	uint16_t port;
+	uint16_t offset;
+	uint16_t len;
+	uint8_t segs;
+};
+
+static struct gro_test_rx gro_rx[CONFIG_NET_GRO_FLOWS + 4];
+static size_t gro_rx_count;
+
+static void generate_mac(uint8_t *mac_addr)
+{
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	mac_addr[0] = 0x00;
+	mac_addr[1] = 0x00;
+	mac_addr[2] = 0x5E;
+	mac_addr[3] = 0x00;
+	mac_addr[4] = 0x53;
+	mac_addr[5] = sys_rand8_get();
+}
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_caps(const struct device *dev)
+{
+	return 0;
+}
+
+static struct ethernet_api api_funcs = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_caps,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	generate_mac(context->mac_addr);
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_gro_test, "eth_gro_test",
+		    eth_init, NULL, &eth_context, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs, NET_ETH_MTU);
+
+static enum net_verdict gro_tcp_received(struct net_conn *conn,
+					 struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 union net_proto_header *proto_hdr,
+					 void *user_data)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + sizeof(struct net_tcp_hdr);
+	struct gro_test_rx *rx;
+
+	zassert_true(gro_rx_count < ARRAY_SIZE(gro_rx), "Too many packets");
+	rx = &gro_rx[gro_rx_count++];
+
+	rx->port = net_ntohs(proto_hdr->tcp->src_port);
+	rx->offset = sys_get_be32(proto_hdr->tcp->seq) - GRO_SEQ;
+	rx->len = net_pkt_get_len(pkt) - hdr_len;
+	rx->segs = net_pkt_gro_segs(pkt);
+
+	/* The IPv4 header of a merged packet is updated incrementally */
+	zassert_equal(net_ntohs(ip_hdr->ipv4->len), net_pkt_get_len(pkt),
+		      "Invalid IPv4 length");
+	zassert_equal(net_calc_chksum_ipv4(pkt), 0, "Invalid IPv4 checksum");
+
+	/* The TCP checksum of a merged packet is the one of its first
+	 * segment, the packet reached us as TCP did not verify it again.
+	 */
+	if (rx->segs > 1) {
+		zassert_not_equal(net_calc_chksum_tcp(pkt), 0,
+				  "TCP checksum of a merged packet is valid");
+	} else {
+		zassert_equal(net_calc_chksum_tcp(pkt), 0, "Invalid TCP checksum");
+	}
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, hdr_len);
+	net_pkt_read(pkt, verify_buf, rx->len);
+	zassert_mem_equal(verify_buf, test_data + rx->offset, rx->len, "Invalid data");
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&wait_data);
+
+	return NET_OK;
+}
+
+/* Create the Ethernet frame of a segment, the headers in the first buffer
+ * as a driver would receive it.
+ */
+static struct net_pkt *gro_seg_create(const struct gro_test_seg *seg)
+{
+	struct net_tcp_hdr tcp_hdr = { 0 };
+	struct net_eth_hdr eth_hdr = { 0 };
+	struct net_pkt *ip_pkt;
+	struct net_pkt *pkt;
+	size_t len;
+	int ret;
+
+	ip_pkt = net_pkt_alloc_with_buffer(test_iface, sizeof(tcp_hdr) + seg->len,
+					   NET_AF_INET, NET_IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(ip_pkt, "Cannot allocate packet");
+
+	ret = net_ipv4_create(ip_pkt, &in4addr_peer, &in4addr_my);
+	zassert_ok(ret, "Cannot create IPv4 header");
+
+	tcp_hdr.src_port = net_htons(seg->port);
+	tcp_hdr.dst_port = net_htons(GRO_PORT);
+	sys_put_be32(GRO_SEQ + seg->offset, tcp_hdr.seq);
+	sys_put_be32(seg->ack, tcp_hdr.ack);
+	tcp_hdr.offset = (sizeof(tcp_hdr) / 4U) << 4;
+	tcp_hdr.flags = seg->flags;
+	sys_put_be16(seg->wnd, tcp_hdr.wnd);
+
+	ret = net_pkt_write(ip_pkt, &tcp_hdr, sizeof(tcp_hdr));
+	zassert_ok(ret, "Cannot write TCP header");
+
+	ret = net_pkt_write(ip_pkt, test_data + seg->offset, seg->len);
+	zassert_ok(ret, "Cannot write data");
+
+	net_pkt_cursor_init(ip_pkt);
+
+	ret = net_ipv4_finalize(ip_pkt, NET_IPPROTO_TCP);
+	zassert_ok(ret, "Cannot finalize packet");
+
+	len = net_pkt_get_len(ip_pkt);
+
+	pkt = net_pkt_rx_alloc_with_buffer(test_iface, sizeof(eth_hdr) + len,
+					   NET_AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate frame");
+
+	memcpy(eth_hdr.dst.addr, net_if_get_link_addr(test_iface)->addr,
+	       sizeof(eth_hdr.dst.addr));
+	generate_mac(eth_hdr.src.addr);
+	eth_hdr.type = net_htons(NET_ETH_PTYPE_IP);
+
+	ret = net_pkt_write(pkt, &eth_hdr, sizeof(eth_hdr));
+	zassert_ok(ret, "Cannot write Ethernet header");
+
+	net_pkt_cursor_init(ip_pkt);
+	ret = net_pkt_copy(pkt, ip_pkt, len);
+	zassert_ok(ret, "Cannot copy packet");
+
+	net_pkt_unref(ip_pkt);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+/* Queue the segments as one batch, then check what TCP got */
+static void test_rx_gro(const struct gro_test_seg *segs, size_t seg_count,
+			const struct gro_test_rx *expected, size_t rx_count)
+{
+	struct net_pkt *pkts[CONFIG_NET_GRO_FLOWS + 4];
+	int ret;
+
+	zassert_true(seg_count <= ARRAY_SIZE(pkts), "Too many segments");
+
+	for (size_t i = 0; i < seg_count; i++) {
+		pkts[i] = gro_seg_create(&segs[i]);
+	}
+
+	/* The RX queue thread must not run before all the segments are
+	 * queued, it holds them until its queue is empty.
+	 */
+	k_sched_lock();
+
+	for (size_t i = 0; i < seg_count; i++) {
+		ret = net_recv_data(test_iface, pkts[i]);
+		if (ret < 0) {
+			k_sched_unlock();
+			zassert_ok(ret, "Cannot receive segment %zu (%d)", i, ret);
+		}
+	}
+
+	k_sched_unlock();
+
+	for (size_t i = 0; i < rx_count; i++) {
+		zassert_ok(k_sem_take(&wait_data, WAIT_TIME),
+			   "Timeout, %zu packets received", gro_rx_count);
+	}
+
+	/* Nothing else is received */
+	zassert_not_ok(k_sem_take(&wait_data, K_MSEC(10)), "Unexpected packet");
+	zassert_equal(gro_rx_count, rx_count, "Received %zu packets, expected %zu",
+		      gro_rx_count, rx_count);
+
+	for (size_t i = 0; i < rx_count; i++) {
+		zassert_equal(gro_rx[i].port, expected[i].port,
+			      "Packet %zu: invalid port %u", i, gro_rx[i].port);
+		zassert_equal(gro_rx[i].offset, expected[i].offset,
+			      "Packet %zu: invalid offset %u", i, gro_rx[i].offset);
+		zassert_equal(gro_rx[i].len, expected[i].len,
+			      "Packet %zu: invalid length %u", i, gro_rx[i].len);
+		zassert_equal(gro_rx[i].segs, expected[i].segs,
+			      "Packet %zu: %u segments merged", i, gro_rx[i].segs);
+	}
+}
+
+#define GRO_SEG(_port, _offset, _len, _flags) \
+	{ .port = _port, .offset = _offset, .len = _len, .ack = GRO_ACK, \
+	  .wnd = GRO_WND, .flags = _flags }
+
+ZTEST(net_gro, test_rx_gro_merge)
+{
+	static const struct gro_test_seg segs[] = {
+		GRO_SEG(TEST_PORT, 0, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 100, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 200, 60, TCP_ACK),
+	};
+	static const struct gro_test_rx expected[] = {
+		{ .port = TEST_PORT, .offset = 0, .len = 260, .segs = 3 },
+	};
+
+	test_rx_gro(segs, ARRAY_SIZE(segs), expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(net_gro, test_rx_gro_ack_wnd_mismatch)
+{
+	struct gro_test_seg segs[] = {
+		GRO_SEG(TEST_PORT, 0, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 100, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 200, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 300, 100, TCP_ACK),
+	};
+	static const struct gro_test_rx expected[] = {
+		{ .port = TEST_PORT, .offset = 0, .len = 100, .segs = 1 },
+		{ .port = TEST_PORT, .offset = 100, .len = 200, .segs = 2 },
+		{ .port = TEST_PORT, .offset = 300, .len = 100, .segs = 1 },
+	};
+
+	segs[1].ack = GRO_ACK + 1;
+	segs[2].ack = GRO_ACK + 1;
+	segs[3].ack = GRO_ACK + 1;
+	segs[3].wnd = GRO_WND / 2;
+
+	test_rx_gro(segs, ARRAY_SIZE(segs), expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(net_gro, test_rx_gro_psh_flush)
+{
+	static const struct gro_test_seg segs[] = {
+		GRO_SEG(TEST_PORT, 0, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 100, 100, TCP_ACK | TCP_PSH),
+		GRO_SEG(TEST_PORT, 200, 100, TCP_ACK),
+	};
+	static const struct gro_test_rx expected[] = {
+		{ .port = TEST_PORT, .offset = 0, .len = 200, .segs = 2 },
+		{ .port = TEST_PORT, .offset = 200, .len = 100, .segs = 1 },
+	};
+
+	test_rx_gro(segs, ARRAY_SIZE(segs), expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(net_gro, test_rx_gro_keep_order)
+{
+	/* A hole in the sequence, a pure ACK and a FIN are not merged, the
+	 * segments held before them are processed first.
+	 */
+	static const struct gro_test_seg segs[] = {
+		GRO_SEG(TEST_PORT, 0, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 200, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 300, 0, TCP_ACK),
+		GRO_SEG(TEST_PORT, 300, 100, TCP_ACK),
+		GRO_SEG(TEST_PORT, 400, 100, TCP_ACK | TCP_FIN),
+	};
+	static const struct gro_test_rx expected[] = {
+		{ .port = TEST_PORT, .offset = 0, .len = 100, .segs = 1 },
+		{ .port = TEST_PORT, .offset = 200, .len = 100, .segs = 1 },
+		{ .port = TEST_PORT, .offset = 300, .len = 0, .segs = 0 },
+		{ .port = TEST_PORT, .offset = 300, .len = 100, .segs = 1 },
+		{ .port = TEST_PORT, .offset = 400, .len = 100, .segs = 0 },
+	};
+
+	test_rx_gro(segs, ARRAY_SIZE(segs), expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(net_gro, test_rx_gro_flow_eviction)
+{
+	struct gro_test_seg segs[CONFIG_NET_GRO_FLOWS + 1];
+	struct gro_test_rx expected[CONFIG_NET_GRO_FLOWS + 1];
+
+	/* One segment more flow than can be held, the oldest flow is
+	 * processed to make room for the last one which then takes its
+	 * place.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(segs); i++) {
+		segs[i] = (struct gro_test_seg)GRO_SEG(TEST_PORT + i, 0, 100, TCP_ACK);
+	}
+
+	expected[0] = (struct gro_test_rx){ .port = TEST_PORT, .len = 100, .segs = 1 };
+	expected[1] = (struct gro_test_rx){ .port = TEST_PORT + CONFIG_NET_GRO_FLOWS,
+					    .len = 100, .segs = 1 };
+
+	for (size_t i = 2; i < ARRAY_SIZE(expected); i++) {
+		expected[i] = (struct gro_test_rx){ .port = TEST_PORT + i - 1,
+						    .len = 100, .segs = 1 };
+	}
+
+	test_rx_gro(segs, ARRAY_SIZE(segs), expected, ARRAY_SIZE(expected));
+}
+
+static void *net_gro_tests_setup(void)
+{
+	struct net_in_addr netmask = { { { 255, 255, 255, 0 } } };
+	struct net_conn_handle *handle;
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	test_iface = net_if_lookup_by_dev(DEVICE_GET(eth_gro_test));
+	zassert_not_null(test_iface, "Interface not found");
+
+	ifaddr = net_if_ipv4_addr_add(test_iface, &in4addr_my, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	net_if_ipv4_set_netmask_by_addr(test_iface, &in4addr_my, &netmask);
+
+	ret = net_conn_register(NET_IPPROTO_TCP, NET_SOCK_STREAM, NET_AF_INET,
+				NULL, NULL, 0, GRO_PORT, NULL,
+				gro_tcp_received, NULL, &handle);
+	zassert_ok(ret, "Cannot register TCP connection");
+
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = (uint8_t)i;
+	}
+
+	return NULL;
+}
+
+static void net_gro_tests_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&wait_data);
+	gro_rx_count = 0;
+}
+
+ZTEST_SUITE(net_gro, NULL, net_gro_tests_setup, net_gro_tests_before, NULL, NULL);
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_GSO_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+
+#include "ipv4.h"
+#include "net_private.h"
+
+#define TEST_PORT 9999
+
+/* Data size of the segments, smaller than the net_buf data size so that
+ * segments cross buffer boundaries.
+ */
+#define GSO_MSS 100
+#define GSO_DATA_LEN 350
+#define GSO_SEQ 1000
+#define GSO_HDR_LEN (sizeof(struct net_ipv4_hdr) + sizeof(struct net_tcp_hdr))
+
+#define TCP_FIN BIT(0)
+#define TCP_PSH BIT(3)
+#define TCP_ACK BIT(4)
+
+#define WAIT_TIME K_MSEC(100)
+
+static uint8_t test_data[GSO_DATA_LEN];
+static uint8_t verify_buf[GSO_MSS];
+
+static struct net_in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+static struct net_in_addr in4addr_dst = { { { 192, 0, 2, 2 } } };
+static struct net_in_addr in4addr_my2 = { { { 192, 0, 42, 1 } } };
+static struct net_in_addr in4addr_dst2 = { { { 192, 0, 42, 2 } } };
+
+/* Interface segmenting in software, and interface with TSO */
+static struct net_if *iface_sw;
+static struct net_if *iface_tso;
+
+static int segment_count;
+static int segment_offset;
+
+static K_SEM_DEFINE(wait_data, 0, UINT_MAX);
+
+struct eth_context {
+	uint8_t mac_addr[6];
+};
+
+static struct eth_context eth_context_sw;
+static struct eth_context eth_context_tso;
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+/* Check a segment created by software GSO, the segments come in order */
+static int eth_tx_sw(const struct device *dev, struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt) - sizeof(struct net_eth_hdr);
+	size_t data_len = MIN(GSO_MSS, GSO_DATA_LEN - segment_offset);
+	bool last = segment_offset + data_len == GSO_DATA_LEN;
+	struct net_ipv4_hdr ipv4_hdr;
+	struct net_tcp_hdr tcp_hdr;
+	struct net_pkt *seg;
+
+	zassert_equal_ptr(dev->data, &eth_context_sw, "Invalid device");
+
+	segment_count++;
+
+	zassert_equal(net_pkt_gso_size(pkt), 0, "Segment %d is a GSO packet",
+		      segment_count);
+	zassert_equal(len, GSO_HDR_LEN + data_len, "Segment %d has length %zu",
+		      segment_count, len);
+
+	/* Copy the segment without its Ethernet header to verify it */
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), len, NET_AF_UNSPEC,
+					0, K_NO_WAIT);
+	zassert_not_null(seg, "Cannot allocate segment copy");
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, sizeof(struct net_eth_hdr));
+	zassert_ok(net_pkt_copy(seg, pkt, len), "Cannot copy segment");
+
+	net_pkt_set_family(seg, NET_AF_INET);
+	net_pkt_set_ip_hdr_len(seg, sizeof(struct net_ipv4_hdr));
+
+	zassert_equal(net_calc_chksum_ipv4(seg), 0, "Incorrect IPv4 checksum");
+	zassert_equal(net_calc_chksum_tcp(seg), 0, "Incorrect TCP checksum");
+
+	net_pkt_cursor_init(seg);
+	net_pkt_read(seg, &ipv4_hdr, sizeof(ipv4_hdr));
+	net_pkt_read(seg, &tcp_hdr, sizeof(tcp_hdr));
+	net_pkt_read(seg, verify_buf, data_len);
+
+	zassert_equal(net_ntohs(ipv4_hdr.len), len, "Invalid IPv4 length");
+	zassert_equal(sys_get_be32(tcp_hdr.seq), GSO_SEQ + segment_offset,
+		      "Invalid sequence number");
+	zassert_equal(tcp_hdr.flags,
+		      last ? TCP_ACK | TCP_PSH | TCP_FIN : TCP_ACK,
+		      "Invalid flags 0x%02x in segment %d", tcp_hdr.flags,
+		      segment_count);
+	zassert_mem_equal(verify_buf, test_data + segment_offset, data_len,
+			  "Invalid data in segment %d", segment_count);
+
+	segment_offset += data_len;
+
+	net_pkt_unref(seg);
+
+	if (last) {
+		k_sem_give(&wait_data);
+	}
+
+	return 0;
+}
+
+/* The device segments the packet itself, it must get it whole */
+static int eth_tx_tso(const struct device *dev, struct net_pkt *pkt)
+{
+	zassert_equal_ptr(dev->data, &eth_context_tso, "Invalid device");
+
+	zassert_equal(net_pkt_gso_size(pkt), GSO_MSS, "GSO size not kept");
+	zassert_equal(net_pkt_get_len(pkt),
+		      sizeof(struct net_eth_hdr) + GSO_HDR_LEN + GSO_DATA_LEN,
+		      "Packet was segmented");
+
+	k_sem_give(&wait_data);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_caps_sw(const struct device *dev)
+{
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_caps_tso(const struct device *dev)
+{
+	return ETHERNET_HW_TSO;
+}
+
+static struct ethernet_api api_funcs_sw = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_caps_sw,
+	.send = eth_tx_sw,
+};
+
+static struct ethernet_api api_funcs_tso = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_caps_tso,
+	.send = eth_tx_tso,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = sys_rand8_get();
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_gso_sw_test, "eth_gso_sw_test",
+		    eth_init, NULL, &eth_context_sw, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_sw, NET_ETH_MTU);
+
+ETH_NET_DEVICE_INIT(eth_gso_tso_test, "eth_gso_tso_test",
+		    eth_init, NULL, &eth_context_tso, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_tso, NET_ETH_MTU);
+
+static struct net_if *iface_setup(const struct device *dev, struct net_in_addr *addr)
+{
+	struct net_in_addr netmask = { { { 255, 255, 255, 0 } } };
+	struct net_if_addr *ifaddr;
+	struct net_if *iface;
+
+	iface = net_if_lookup_by_dev(dev);
+	zassert_not_null(iface, "Interface not found");
+
+	ifaddr = net_if_ipv4_addr_add(iface, addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	net_if_ipv4_set_netmask_by_addr(iface, addr, &netmask);
+
+	return iface;
+}
+
+/* Create a TCP packet with GSO_DATA_LEN bytes of data to be sent in segments
+ * of GSO_MSS bytes. With data_in_own_buf, the data is put in buffers of its
+ * own after the headers, as TCP does.
+ */
+static struct net_pkt *gso_pkt_create(bool offloaded, bool data_in_own_buf)
+{
+	struct net_if *iface = offloaded ? iface_tso : iface_sw;
+	struct net_tcp_hdr tcp_hdr = { 0 };
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_alloc_with_buffer(iface, sizeof(struct net_tcp_hdr) +
+					(data_in_own_buf ? 0 : GSO_DATA_LEN),
+					NET_AF_INET, NET_IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	ret = net_ipv4_create(pkt, offloaded ? &in4addr_my2 : &in4addr_my,
+			      offloaded ? &in4addr_dst2 : &in4addr_dst);
+	zassert_ok(ret, "Cannot create IPv4 header");
+
+	tcp_hdr.src_port = net_htons(TEST_PORT);
+	tcp_hdr.dst_port = net_htons(TEST_PORT);
+	sys_put_be32(GSO_SEQ, tcp_hdr.seq);
+	tcp_hdr.offset = (sizeof(struct net_tcp_hdr) / 4U) << 4;
+	tcp_hdr.flags = TCP_ACK | TCP_PSH | TCP_FIN;
+	sys_put_be16(UINT16_MAX, tcp_hdr.wnd);
+
+	ret = net_pkt_write(pkt, &tcp_hdr, sizeof(tcp_hdr));
+	zassert_ok(ret, "Cannot write TCP header");
+
+	if (data_in_own_buf) {
+		struct net_pkt *data;
+
+		data = net_pkt_alloc_with_buffer(iface, GSO_DATA_LEN, NET_AF_UNSPEC,
+						 0, K_NO_WAIT);
+		zassert_not_null(data, "Cannot allocate data");
+
+		ret = net_pkt_write(data, test_data, GSO_DATA_LEN);
+		zassert_ok(ret, "Cannot write data");
+
+		net_pkt_append_buffer(pkt, data->buffer);
+		data->buffer = NULL;
+		net_pkt_unref(data);
+	} else {
+		ret = net_pkt_write(pkt, test_data, GSO_DATA_LEN);
+		zassert_ok(ret, "Cannot write data");
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	ret = net_ipv4_finalize(pkt, NET_IPPROTO_TCP);
+	zassert_ok(ret, "Cannot finalize packet");
+
+	net_pkt_set_gso_size(pkt, GSO_MSS);
+
+	return pkt;
+}
+
+static void test_tx_gso(bool offloaded, bool data_in_own_buf)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = gso_pkt_create(offloaded, data_in_own_buf);
+
+	ret = net_send_data(pkt);
+	zassert_ok(ret, "Cannot send GSO packet (%d)", ret);
+
+	zassert_ok(k_sem_take(&wait_data, WAIT_TIME), "Timeout");
+
+	if (!offloaded) {
+		zassert_equal(segment_count, DIV_ROUND_UP(GSO_DATA_LEN, GSO_MSS),
+			      "Invalid number of segments (%d)", segment_count);
+	}
+}
+
+ZTEST(net_gso, test_tx_gso_data_moved)
+{
+	test_tx_gso(false, true);
+}
+
+ZTEST(net_gso, test_tx_gso_data_copied)
+{
+	test_tx_gso(false, false);
+}
+
+ZTEST(net_gso, test_tx_gso_hw_tso)
+{
+	test_tx_gso(true, true);
+}
+
+static void *net_gso_tests_setup(void)
+{
+	iface_sw = iface_setup(DEVICE_GET(eth_gso_sw_test), &in4addr_my);
+	iface_tso = iface_setup(DEVICE_GET(eth_gso_tso_test), &in4addr_my2);
+
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = (uint8_t)i;
+	}
+
+	return NULL;
+}
+
+static void net_gso_tests_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&wait_data);
+
+	segment_count = 0;
+	segment_offset = 0;
+}
+
+ZTEST_SUITE(net_gso, NULL, net_gso_tests_setup, net_gso_tests_before, NULL, NULL);
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_NAPI_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+
+#include "connection.h"
+#include "ipv4.h"
+#include "net_private.h"
+
+#define TEST_PORT 9999
+
+/* Packets are sent to this port */
+#define NAPI_PORT 4242
+#define NAPI_SEQ 5000
+#define NAPI_ACK 7000
+#define NAPI_WND 8192
+#define NAPI_SEG_LEN 50
+
+#define TCP_ACK BIT(4)
+
+#define WAIT_TIME K_MSEC(100)
+
+/* Two budgets and one packet, then one more packet */
+#define NAPI_PKTS (2 * CONFIG_NET_NAPI_BUDGET + 2)
+
+static uint8_t test_data[NAPI_PKTS * NAPI_SEG_LEN];
+static uint8_t verify_buf[sizeof(test_data)];
+
+static struct net_in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+static struct net_in_addr in4addr_peer = { { { 192, 0, 2, 2 } } };
+
+static struct net_if *test_iface;
+
+static K_SEM_DEFINE(wait_data, 0, UINT_MAX);
+
+struct eth_context {
+	uint8_t mac_addr[6];
+};
+
+static struct eth_context eth_context;
+
+/* Packet processed by TCP, merged by GRO or not */
+struct napi_test_rx {
+	uint16_t offset;
+	uint16_t len;
+	uint8_t segs;
+};
+
+static struct napi_test_rx napi_rx[NAPI_PKTS];
+static size_t napi_rx_count;
+
+static struct net_napi test_napi;
+static K_SEM_DEFINE(wait_napi_complete, 0, 1);
+
+/* Packets pending in the device, and where their data starts */
+static int napi_pending;
+static uint16_t napi_offset;
+static int napi_polls;
+
+static void generate_mac(uint8_t *mac_addr)
+{
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	mac_addr[0] = 0x00;
+	mac_addr[1] = 0x00;
+	mac_addr[2] = 0x5E;
+	mac_addr[3] = 0x00;
+	mac_addr[4] = 0x53;
+	mac_addr[5] = sys_rand8_get();
+}
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_caps(const struct device *dev)
+{
+	return 0;
+}
+
+static struct ethernet_api api_funcs = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_caps,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	generate_mac(context->mac_addr);
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_napi_test, "eth_napi_test",
+		    eth_init, NULL, &eth_context, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs, NET_ETH_MTU);
+
+static enum net_verdict napi_tcp_received(struct net_conn *conn,
+					  struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr,
+					  void *user_data)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + sizeof(struct net_tcp_hdr);
+	struct napi_test_rx *rx;
+
+	zassert_true(napi_rx_count < ARRAY_SIZE(napi_rx), "Too many packets");
+	rx = &napi_rx[napi_rx_count++];
+
+	rx->offset = sys_get_be32(proto_hdr->tcp->seq) - NAPI_SEQ;
+	rx->len = net_pkt_get_len(pkt) - hdr_len;
+	rx->segs = net_pkt_gro_segs(pkt);
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+	net_pkt_skip(pkt, hdr_len);
+	net_pkt_read(pkt, verify_buf, rx->len);
+	zassert_mem_equal(verify_buf, test_data + rx->offset, rx->len, "Invalid data");
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&wait_data);
+
+	return NET_OK;
+}
+
+/* Create the Ethernet frame of a TCP segment, the headers in the first
+ * buffer as a driver would receive it.
+ */
+static struct net_pkt *napi_pkt_create(uint16_t offset)
+{
+	struct net_tcp_hdr tcp_hdr = { 0 };
+	struct net_eth_hdr eth_hdr = { 0 };
+	struct net_pkt *ip_pkt;
+	struct net_pkt *pkt;
+	size_t len;
+	int ret;
+
+	ip_pkt = net_pkt_alloc_with_buffer(test_iface, sizeof(tcp_hdr) + NAPI_SEG_LEN,
+					   NET_AF_INET, NET_IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(ip_pkt, "Cannot allocate packet");
+
+	ret = net_ipv4_create(ip_pkt, &in4addr_peer, &in4addr_my);
+	zassert_ok(ret, "Cannot create IPv4 header");
+
+	tcp_hdr.src_port = net_htons(TEST_PORT);
+	tcp_hdr.dst_port = net_htons(NAPI_PORT);
+	sys_put_be32(NAPI_SEQ + offset, tcp_hdr.seq);
+	sys_put_be32(NAPI_ACK, tcp_hdr.ack);
+	tcp_hdr.offset = (sizeof(tcp_hdr) / 4U) << 4;
+	tcp_hdr.flags = TCP_ACK;
+	sys_put_be16(NAPI_WND, tcp_hdr.wnd);
+
+	ret = net_pkt_write(ip_pkt, &tcp_hdr, sizeof(tcp_hdr));
+	zassert_ok(ret, "Cannot write TCP header");
+
+	ret = net_pkt_write(ip_pkt, test_data + offset, NAPI_SEG_LEN);
+	zassert_ok(ret, "Cannot write data");
+
+	net_pkt_cursor_init(ip_pkt);
+
+	ret = net_ipv4_finalize(ip_pkt, NET_IPPROTO_TCP);
+	zassert_ok(ret, "Cannot finalize packet");
+
+	len = net_pkt_get_len(ip_pkt);
+
+	pkt = net_pkt_rx_alloc_with_buffer(test_iface, sizeof(eth_hdr) + len,
+					   NET_AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate frame");
+
+	memcpy(eth_hdr.dst.addr, net_if_get_link_addr(test_iface)->addr,
+	       sizeof(eth_hdr.dst.addr));
+	generate_mac(eth_hdr.src.addr);
+	eth_hdr.type = net_htons(NET_ETH_PTYPE_IP);
+
+	ret = net_pkt_write(pkt, &eth_hdr, sizeof(eth_hdr));
+	zassert_ok(ret, "Cannot write Ethernet header");
+
+	net_pkt_cursor_init(ip_pkt);
+	ret = net_pkt_copy(pkt, ip_pkt, len);
+	zassert_ok(ret, "Cannot copy packet");
+
+	net_pkt_unref(ip_pkt);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+static int napi_test_poll(struct net_napi *napi, int budget)
+{
+	int done = 0;
+
+	zassert_equal_ptr(napi, &test_napi, "Invalid poll context");
+	zassert_equal(budget, CONFIG_NET_NAPI_BUDGET, "Invalid budget %d", budget);
+
+	napi_polls++;
+
+	/* An interrupt while being polled does not add a poll */
+	net_napi_schedule(napi);
+
+	while (done < budget && napi_pending > 0) {
+		int ret;
+
+		ret = net_napi_receive(napi, napi_pkt_create(napi_offset));
+		zassert_ok(ret, "Cannot receive packet (%d)", ret);
+
+		napi_offset += NAPI_SEG_LEN;
+		napi_pending--;
+		done++;
+	}
+
+	if (done < budget) {
+		net_napi_complete(napi);
+		k_sem_give(&wait_napi_complete);
+	}
+
+	return done;
+}
+
+/* Check what TCP got from polls receiving the given numbers of packets,
+ * starting at offset. With GRO, the packets received in a poll are merged.
+ */
+static void napi_rx_check(uint16_t offset, const int *poll_pkts, size_t polls)
+{
+	struct napi_test_rx expected[NAPI_PKTS];
+	size_t count = 0;
+
+	for (size_t i = 0; i < polls; i++) {
+		if (IS_ENABLED(CONFIG_NET_GRO)) {
+			expected[count++] = (struct napi_test_rx){
+				.offset = offset,
+				.len = poll_pkts[i] * NAPI_SEG_LEN,
+				.segs = poll_pkts[i],
+			};
+			offset += poll_pkts[i] * NAPI_SEG_LEN;
+			continue;
+		}
+
+		for (int j = 0; j < poll_pkts[i]; j++) {
+			expected[count++] = (struct napi_test_rx){
+				.offset = offset,
+				.len = NAPI_SEG_LEN,
+			};
+			offset += NAPI_SEG_LEN;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&wait_data, WAIT_TIME),
+			   "Timeout, %zu packets received", napi_rx_count);
+	}
+
+	/* Nothing else is received */
+	zassert_not_ok(k_sem_take(&wait_data, K_MSEC(10)), "Unexpected packet");
+	zassert_equal(napi_rx_count, count, "Received %zu packets, expected %zu",
+		      napi_rx_count, count);
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(napi_rx[i].offset, expected[i].offset,
+			      "Packet %zu: invalid offset %u", i, napi_rx[i].offset);
+		zassert_equal(napi_rx[i].len, expected[i].len,
+			      "Packet %zu: invalid length %u", i, napi_rx[i].len);
+		zassert_equal(napi_rx[i].segs, expected[i].segs,
+			      "Packet %zu: %u segments merged", i, napi_rx[i].segs);
+	}
+}
+
+ZTEST(net_napi, test_rx_napi_budget)
+{
+	static const int polls[] = {
+		CONFIG_NET_NAPI_BUDGET, CONFIG_NET_NAPI_BUDGET, 1,
+	};
+	static const int polls_again[] = { 1 };
+
+	net_napi_init(&test_napi, test_iface, napi_test_poll);
+
+	/* Two budgets and one packet: the device is polled again as long as
+	 * it uses up its budget.
+	 */
+	napi_pending = 2 * CONFIG_NET_NAPI_BUDGET + 1;
+	napi_offset = 0;
+	napi_polls = 0;
+	k_sem_reset(&wait_napi_complete);
+
+	net_napi_schedule(&test_napi);
+
+	zassert_ok(k_sem_take(&wait_napi_complete, WAIT_TIME), "Polling not complete");
+	napi_rx_check(0, polls, ARRAY_SIZE(polls));
+	zassert_equal(napi_polls, 3, "Polled %d times", napi_polls);
+
+	/* Once complete, the polling is scheduled again */
+	napi_pending = 1;
+	napi_rx_count = 0;
+
+	net_napi_schedule(&test_napi);
+
+	zassert_ok(k_sem_take(&wait_napi_complete, WAIT_TIME), "Polling not complete");
+	napi_rx_check((2 * CONFIG_NET_NAPI_BUDGET + 1) * NAPI_SEG_LEN, polls_again,
+		      ARRAY_SIZE(polls_again));
+	zassert_equal(napi_polls, 4, "Polled %d times", napi_polls);
+}
+
+static void *net_napi_tests_setup(void)
+{
+	struct net_in_addr netmask = { { { 255, 255, 255, 0 } } };
+	struct net_conn_handle *handle;
+	struct net_if_addr *ifaddr;
+	int ret;
+
+	test_iface = net_if_lookup_by_dev(DEVICE_GET(eth_napi_test));
+	zassert_not_null(test_iface, "Interface not found");
+
+	ifaddr = net_if_ipv4_addr_add(test_iface, &in4addr_my, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	net_if_ipv4_set_netmask_by_addr(test_iface, &in4addr_my, &netmask);
+
+	ret = net_conn_register(NET_IPPROTO_TCP, NET_SOCK_STREAM, NET_AF_INET,
+				NULL, NULL, 0, NAPI_PORT, NULL,
+				napi_tcp_received, NULL, &handle);
+	zassert_ok(ret, "Cannot register TCP connection");
+
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = (uint8_t)i;
+	}
+
+	return NULL;
+}
+
+static void net_napi_tests_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&wait_data);
+	napi_rx_count = 0;
+}
+
+ZTEST_SUITE(net_napi, NULL, net_napi_tests_setup, net_napi_tests_before, NULL, NULL);
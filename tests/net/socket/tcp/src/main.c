@@ -2542,6 +2542,108 @@ ZTEST(net_socket_tcp, test_so_keepalive_opt)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_so_tcp_congestion_opt)
+{
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	struct net_sockaddr_in bind_addr4;
+	char name[16];
+	net_socklen_t optlen = sizeof(name);
+	int sock, ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, CONFIG_NET_TCP_CA_DEFAULT, "getsockopt got invalid value");
+	zassert_equal(optlen, sizeof(CONFIG_NET_TCP_CA_DEFAULT), "getsockopt got invalid size");
+
+	/* The name does not need to be zero terminated */
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+			       "newreno", strlen("newreno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	ret = zsock_getsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "newreno", "getsockopt got invalid value");
+
+	ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+			       "vegas", sizeof("vegas"));
+	zassert_equal(ret, -1, "setsockopt should fail");
+	zassert_equal(errno, ENOENT, "setsockopt got invalid error %d", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CA_CUBIC)) {
+		ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+				       "cubic", sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CA_BBR)) {
+		ret = zsock_setsockopt(sock, NET_IPPROTO_TCP, ZSOCK_TCP_CONGESTION,
+				       "bbr", sizeof("bbr"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(net_socket_tcp, test_so_tcp_info_opt)
+{
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	struct net_sockaddr_in c_saddr, s_saddr;
+	struct net_sockaddr addr;
+	net_socklen_t addrlen = sizeof(addr);
+	struct zsock_tcp_info info;
+	net_socklen_t optlen;
+	int c_sock, s_sock, new_sock;
+	int ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct net_sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	test_recv(new_sock, 0);
+
+	optlen = sizeof(info);
+	ret = zsock_getsockopt(c_sock, NET_IPPROTO_TCP, ZSOCK_TCP_INFO, &info, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optlen, sizeof(info), "getsockopt got invalid size");
+	zassert_true(info.cwnd > 0, "no congestion window");
+	zassert_true(info.ssthresh > 0, "no slow start threshold");
+	zassert_true(info.min_rtt_ms <= info.srtt_ms, "minimum RTT %u above smoothed RTT %u",
+		     info.min_rtt_ms, info.srtt_ms);
+
+	optlen = sizeof(info) - 1;
+	ret = zsock_getsockopt(c_sock, NET_IPPROTO_TCP, ZSOCK_TCP_INFO, &info, &optlen);
+	zassert_equal(ret, -1, "getsockopt should fail");
+	zassert_equal(errno, EINVAL, "getsockopt got invalid error %d", errno);
+
+	ret = zsock_setsockopt(c_sock, NET_IPPROTO_TCP, ZSOCK_TCP_INFO, &info, sizeof(info));
+	zassert_equal(ret, -1, "setsockopt should fail");
+
+	test_close(c_sock);
+	test_eof(new_sock);
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void test_prepare_keepalive_socks(int *c_sock, int *s_sock, int *new_sock)
 {
 	struct net_sockaddr_in c_saddr, s_saddr;
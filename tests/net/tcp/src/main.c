@@ -116,6 +116,8 @@ static enum test_case_no {
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
 	TEST_SERVER_FIN_ACK_AFTER_DATA = 21,
+	TEST_SERVER_SACK = 22,
+	TEST_SERVER_RACK = 23,
 } test_case_no;
 
 static enum test_state t_state;
@@ -143,6 +145,8 @@ static void handle_client_fin_ack_with_data_test(net_sa_family_t af, struct tcph
 static void handle_client_seq_validation_test(net_sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
 static void handle_server_fin_ack_after_data_test(net_sa_family_t af, struct tcphdr *th);
+static void handle_server_sack_test(struct net_pkt *pkt);
+static void handle_server_rack_test(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -238,6 +242,13 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* SACK option added to the packets without SYN, if its length is set */
+static uint8_t sack_options[12] = {
+	0x01, 0x01, /* NOP */
+	0x05, 0x0a, /* SACK, one block */
+};
+static size_t sack_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -248,11 +259,16 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (!(flags & SYN)) {
+		opts = sack_options;
+		opts_len = sack_options_len;
 	}
 
 	/* Allocate buffer */
@@ -287,11 +303,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = net_htons(NET_IPV6_MTU);
@@ -306,9 +318,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(net_sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -496,6 +508,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_FIN_ACK_AFTER_DATA:
 		handle_server_fin_ack_after_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_SERVER_SACK:
+		handle_server_sack_test(pkt);
+		break;
+	case TEST_SERVER_RACK:
+		handle_server_rack_test(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -2224,6 +2242,290 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+static uint32_t sack_start;
+static uint32_t sack_end;
+static bool sack_found;
+
+static void handle_server_sack_test(struct net_pkt *pkt)
+{
+	uint8_t opts[40];
+	struct tcphdr th;
+	size_t opts_len;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	zassert_equal(expected_ack, net_ntohl(th.th_ack),
+		      "Expected ACK %u but got %u", expected_ack, net_ntohl(th.th_ack));
+
+	sack_found = false;
+	opts_len = (th.th_off - 5) * 4;
+
+	if (opts_len > 0) {
+		net_pkt_set_overwrite(pkt, true);
+		net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			     sizeof(struct tcphdr));
+
+		ret = net_pkt_read(pkt, opts, opts_len);
+		if (ret < 0) {
+			goto fail;
+		}
+
+		for (size_t i = 0; i < opts_len; ) {
+			if (opts[i] == NET_TCP_END_OPT) {
+				break;
+			}
+
+			if (opts[i] == NET_TCP_NOP_OPT) {
+				i++;
+				continue;
+			}
+
+			if (opts[i] == NET_TCP_SACK_OPT) {
+				/* The first block holds the latest out-of-order data */
+				sack_start = net_ntohl(UNALIGNED_GET((uint32_t *)&opts[i + 2]));
+				sack_end = net_ntohl(UNALIGNED_GET((uint32_t *)&opts[i + 6]));
+				sack_found = true;
+			}
+
+			i += opts[i + 1];
+		}
+	}
+
+	test_sem_give();
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+static void send_sack_test_data(uint32_t seq_base, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	seq = seq_base + offset;
+	pkt = prepare_data_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT),
+				  (const uint8_t *)&lorem_ipsum[offset], len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	test_sem_take(K_MSEC(1000), __LINE__);
+}
+
+/* Test case scenario
+ *   Establish the connection, SACK permitted
+ *   send data after a gap,
+ *   expect duplicate ACK with a SACK block for the data,
+ *   send the missing data,
+ *   expect ACK for all the data and no SACK block.
+ */
+ZTEST(net_tcp, test_server_sack_out_of_order)
+{
+#if defined(CONFIG_NET_TCP_SACK)
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	uint32_t seq_base;
+	int ret;
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_server_socket(0, 0);
+
+	/* The test peer does not send options in its SYN */
+	accepted_ctx->tcp->sack_ok = true;
+
+	test_case_no = TEST_SERVER_SACK;
+	seq_base = seq;
+	expected_ack = seq_base;
+
+	send_sack_test_data(seq_base, 10, 20);
+	zassert_true(sack_found, "No SACK block in the duplicate ACK");
+	zassert_equal(sack_start, seq_base + 10, "Invalid SACK block start %u", sack_start);
+	zassert_equal(sack_end, seq_base + 30, "Invalid SACK block end %u", sack_end);
+
+	expected_ack = seq_base + 30;
+
+	send_sack_test_data(seq_base, 0, 10);
+	zassert_false(sack_found, "SACK block sent with no out-of-order data");
+
+	seq = expected_ack;
+	rst = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_NET_TCP_SACK */
+}
+
+#define RACK_MAX_SEGS 8
+
+static uint32_t rack_seqs[RACK_MAX_SEGS];
+static size_t rack_lens[RACK_MAX_SEGS];
+static atomic_t rack_sent;
+
+/* Record the data segments sent by the server, ACKs are ignored */
+static void handle_server_rack_test(struct net_pkt *pkt)
+{
+	struct tcphdr th;
+	size_t len;
+	int idx;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) - net_pkt_ip_opts_len(pkt) -
+	      th.th_off * 4U;
+	if (len == 0) {
+		return;
+	}
+
+	idx = atomic_inc(&rack_sent);
+	if (idx < RACK_MAX_SEGS) {
+		rack_seqs[idx] = net_ntohl(th.th_seq);
+		rack_lens[idx] = len;
+	}
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+static void wait_rack_sent(int count, int line)
+{
+	for (int i = 0; i < 100 && atomic_get(&rack_sent) < count; i++) {
+		k_msleep(1);
+	}
+
+	zassert_equal(atomic_get(&rack_sent), count, "%d segments sent instead of %d (line %d)",
+		      (int)atomic_get(&rack_sent), count, line);
+}
+
+static void send_rack_test_data(int offset, int len)
+{
+	int ret;
+
+	ret = net_context_send(accepted_ctx, &lorem_ipsum[offset], len, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, len, "Failed to send data to peer %d", ret);
+}
+
+/* Send an ACK from the peer, with a SACK block if end is not zero */
+static void send_rack_test_ack(uint32_t ack_seq, uint32_t start, uint32_t end)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	if (end != 0) {
+		UNALIGNED_PUT(net_htonl(start), (uint32_t *)&sack_options[4]);
+		UNALIGNED_PUT(net_htonl(end), (uint32_t *)&sack_options[8]);
+		sack_options_len = sizeof(sack_options);
+	}
+
+	ack = ack_seq;
+	pkt = prepare_ack_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	sack_options_len = 0;
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the IP stack process the packet */
+	k_msleep(1);
+}
+
+/* Test case scenario
+ *   Establish the connection, SACK permitted
+ *   send two segments back to back, ACK the first one,
+ *   expect no retransmission of the second one,
+ *   after some time send two more segments,
+ *   SACK them but not the second segment,
+ *   expect exactly the second segment to be retransmitted.
+ */
+ZTEST(net_tcp, test_server_rack_loss_detection)
+{
+#if defined(CONFIG_NET_TCP_RACK)
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	uint32_t seq_base;
+	int ret;
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_server_socket(0, 0);
+	seq_base = ack;
+
+	/* The test peer does not send options in its SYN */
+	accepted_ctx->tcp->sack_ok = true;
+	accepted_ctx->tcp->tcp_nodelay = true;
+
+	test_case_no = TEST_SERVER_RACK;
+	atomic_clear(&rack_sent);
+
+	/* Segments sent in the same tick are ordered by sequence number */
+	send_rack_test_data(0, 10);
+	send_rack_test_data(10, 10);
+	wait_rack_sent(2, __LINE__);
+	zassert_equal(rack_seqs[0], seq_base, "Invalid seq %u", rack_seqs[0]);
+	zassert_equal(rack_seqs[1], seq_base + 10, "Invalid seq %u", rack_seqs[1]);
+
+	send_rack_test_ack(seq_base + 10, 0, 0);
+	k_msleep(5);
+	wait_rack_sent(2, __LINE__);
+
+	/* Sent well after the second segment, which is then lost once they
+	 * are delivered.
+	 */
+	k_msleep(10);
+	send_rack_test_data(20, 10);
+	send_rack_test_data(30, 10);
+	wait_rack_sent(4, __LINE__);
+
+	send_rack_test_ack(seq_base + 10, seq_base + 20, seq_base + 40);
+	wait_rack_sent(5, __LINE__);
+	zassert_equal(rack_seqs[4], seq_base + 10, "Wrong segment resent, seq %u", rack_seqs[4]);
+	zassert_equal(rack_lens[4], 10, "Wrong resent length %zu", rack_lens[4]);
+
+	send_rack_test_ack(seq_base + 40, 0, 0);
+	k_msleep(5);
+	wait_rack_sent(5, __LINE__);
+
+	rst = prepare_rst_packet(NET_AF_INET6, net_htons(MY_PORT), net_htons(PEER_PORT));
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_NET_TCP_RACK */
+}
+
 static void handle_server_rst_on_closed_port(net_sa_family_t af, struct tcphdr *th)
 {
 	switch (t_state) {
@@ -1365,6 +1365,64 @@ ZTEST(test_utils_fn, test_ip_checksum)
 	}
 }
 
+static uint16_t ipv4_hdr_chksum(const struct net_ipv4_hdr *hdr)
+{
+	struct net_ipv4_hdr tmp = *hdr;
+	uint16_t sum;
+
+	tmp.chksum = 0U;
+	sum = calc_chksum(0, (const uint8_t *)&tmp, sizeof(tmp));
+	sum = (sum == 0U) ? 0xffff : net_htons(sum);
+
+	return ~sum;
+}
+
+ZTEST(test_utils_fn, test_ip_checksum_update)
+{
+	struct net_ipv4_hdr hdr = {
+		.vhl = 0x45,
+		.len = net_htons(1500),
+		.ttl = 64,
+		.proto = NET_IPPROTO_TCP,
+		.src = { 192, 0, 2, 1 },
+		.dst = { 198, 51, 100, 7 },
+	};
+	uint8_t new_addr[NET_IPV4_ADDR_SIZE] = { 203, 0, 113, 254 };
+	uint16_t old_val;
+
+	hdr.chksum = ipv4_hdr_chksum(&hdr);
+
+	/* TTL decrement, the TTL sharing its word with the protocol */
+	for (int i = 0; i < 64; i++) {
+		old_val = UNALIGNED_GET((uint16_t *)&hdr.ttl);
+		hdr.ttl--;
+		hdr.chksum = net_chksum_update_16(hdr.chksum, old_val,
+						  UNALIGNED_GET((uint16_t *)&hdr.ttl));
+
+		zassert_equal(hdr.chksum, ipv4_hdr_chksum(&hdr),
+			      "Mismatch after TTL update %d", i);
+	}
+
+	/* Total length change */
+	old_val = hdr.len;
+	hdr.len = net_htons(40);
+	hdr.chksum = net_chksum_update_16(hdr.chksum, old_val, hdr.len);
+
+	zassert_equal(hdr.chksum, ipv4_hdr_chksum(&hdr), "Mismatch after length update");
+
+	/* Address rewrite */
+	hdr.chksum = net_chksum_update_32(hdr.chksum, UNALIGNED_GET((uint32_t *)hdr.src),
+					  UNALIGNED_GET((uint32_t *)new_addr));
+	memcpy(hdr.src, new_addr, sizeof(hdr.src));
+
+	zassert_equal(hdr.chksum, ipv4_hdr_chksum(&hdr), "Mismatch after address update");
+
+	hdr.chksum = net_chksum_update(hdr.chksum, hdr.dst, new_addr, sizeof(hdr.dst));
+	memcpy(hdr.dst, new_addr, sizeof(hdr.dst));
+
+	zassert_equal(hdr.chksum, ipv4_hdr_chksum(&hdr), "Mismatch after data update");
+}
+
 /* Verify that the net_pkt pointer to the received link layer address
  * is correct.
  */